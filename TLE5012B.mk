@@ -17,9 +17,24 @@ GLOBAL_INCLUDES  := src/config \
 
 $(NAME)_SOURCES  := src/corelib/TLE5012b.cpp \
 					src/corelib/tle5012b_reg.cpp \
+					src/corelib/tle5012b_safety.cpp \
+					src/corelib/tle5012b_sampler.cpp \
+					src/corelib/tle5012b_pipeline.cpp \
+					src/corelib/tle5012b_iif.cpp \
+					src/corelib/tle5012b_pwm.cpp \
+					src/corelib/tle5012b_spc.cpp \
+					src/corelib/tle5012b_hsm.cpp \
+					src/corelib/tle5012b_foc.cpp \
+					src/corelib/tle5012b_tempcomp.cpp \
+					src/corelib/tle5012b_shadow.cpp \
+					src/corelib/tle5012b_recovery.cpp \
+					src/corelib/tle5012b_health.cpp \
 					src/pal/gpio.cpp \
 					src/pal/spic.cpp \
+					src/pal/bus-arbiter.cpp \
+					src/pal/spic-shared.cpp \
 					src/framework/wiced-43xxx/pal/timer-wiced.cpp \
+					src/framework/wiced-43xxx/pal/semaphore-wiced.cpp \
 					src/framework/wiced-43xxx/pal/gpio-wiced.cpp \
 					src/framework/wiced-43xxx/pal/spic-wiced.cpp \
 					src/framework/wiced-43xxx/pal/TLE5012-pal-wiced.cpp
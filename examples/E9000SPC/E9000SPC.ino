@@ -7,36 +7,51 @@
  * \details
  * The TLE5012B-E9000 with SPC interface does not start the DSP automatically in a loop at start up.
  * It will need a certain trigger on the IFA pin of the sensor.
- * This trigger must be in a 90 UT time frame at least 12 UT long for the first sensor. By
- * multiplying the 12 UT with the sensor slave number up to four sensors can be triggered.
- * This trigger setting UT the unittime must multiplied with the sensors base unittime which
- * is default 3.0µs. Setting the IFA pin to low and waiting atleast the total trigger time
- * will set all registers by the DSP. 
- * For more information please read the SPC Interface section of the manual.
- * The default setup ist: 
- * - unittime =3.0µs, 
+ * This trigger must be at least 12 UT long for the first sensor. By multiplying the 12 UT with
+ * the sensor slave number up to four sensors can be triggered on the same line.
+ * The unit time UT is the sensors base unittime which is default 3.0µs and is set with the
+ * hysteresis bits of the IFAB register.
+ * After the trigger the sensor answers with a SPC frame on the same line: a synchronization
+ * period, the status nibble, the angle (and temperature) nibbles and a CRC nibble.
+ * The Tle5012bSPC engine generates the trigger, timestamps the falling edges and decodes
+ * the frame. The unit time is calibrated with the synchronization period of each frame.
+ * The SPC parameters are read once over the SSC interface.
+ * The default setup ist:
+ * - unittime =3.0µs,
  * - total trigger time = 90 * 3.0µs = 270 µs
  * - t_mlow the time for the first sensor to trigger = 12 * 3.0µs = 36 µs
- * so we have to set the IFA pin 36µs to low, than back to high and wait (90-12)*3.0µs = 224µs
- *  
+ * - 12 bit angle frame
+ *
+ * IFA needs an external interrupt and a pull up, as the master and the sensor
+ * only pull the line low.
+ * The capture needs at least 8 ticks per unit time to separate the nibbles. The
+ * micros() timestamps of CaptureIno are too coarse and spc.begin() fails with
+ * them, replace spcCapture with a timer input capture of the board, e.g. 16 MHz.
+ *
+ * For more information please read the SPC Interface section of the manual.
+ *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include <TLE5012-ino.hpp>
+#include "corelib/tle5012b_spc.hpp"
+#include "framework/arduino/pal/capture-arduino.hpp"
 
 //!< \brief GPIO pin number of IFA on the Sensor2Go kit
 #define        IFA        9
 
-float    unitTime    = 3.0;  //!< \brief UT is default 3.0µs but will be read with getHysteresisMode
-float    triggerTime = 90;   //!< \brief trigger total time is default 90UT * 3.0µs
-float    t_mlow      = 12;   //!< \brief trigger will last default for 12 * 3.0µs 
-
+//!< \brief number of sensors on the SPC line
+#define        SENSORS    1
 
 // Tle5012b Object
-Tle5012Ino Tle5012Sensor = Tle5012Ino();
+Tle5012Ino Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
-updTypes upd = UPD_high;
+
+// SPC master on IFA, the line is released as input to the pull up
+GPIOIno    spcTrigger(IFA, INPUT, GPIO::POSITIVE);
+CaptureIno spcCapture(IFA);
+Tle5012bSPC spc(spcTrigger, spcCapture, OUTPUT, INPUT);
 
 void setup() {
   delay(2000);
@@ -50,60 +65,39 @@ void setup() {
   Tle5012Sensor.sBus->triggerUpdate();
   delay(1000);
 
-  pinMode(IFA, OUTPUT);
-  digitalWrite(IFA, HIGH);
-
-  // Fetch sensor UT base value
-  uint8_t val = Tle5012Sensor.reg.getHysteresisMode();
-  unitTime = (val == 0 
-    ? 3.0 
-    : (val == 1 
-      ? 2.5
-      : (val == 2 
-        ? 2.0
-        : 1.5
-      )
-    )
-  );
-
-  // Fetch SPC Total Trigger Time
-  val = Tle5012Sensor.reg.getHSMplp();
-  triggerTime = ( val == 0
-    ? 90 
-    : (t_mlow + 12)
-  );
+  // Fetch unit time, frame layout and total trigger time
+  checkError = spc.configure(Tle5012Sensor);
+  Serial.print("unittime:   "); Serial.print(spc.unitTime() / 256.0); Serial.println(" ticks");
 
+  checkError = spc.begin();
+  if (checkError != NO_ERROR) {
+    Serial.println("capture too coarse for SPC, a timer input capture is needed");
+  }
 }
 
 void loop() {
 
-
-  double a = 0.0;
-  double rr = 0.0;
-  int16_t ra = 0;
-  int16_t r = 0;
-  double t = 0.0;
-  int16_t rt = 0;
-  double s = 0.0;
-  int16_t rs = 0;
-  
-  digitalWrite(IFA, LOW);
-  delayMicroseconds(t_mlow + unitTime);
-  digitalWrite(IFA, HIGH);
-  delayMicroseconds((triggerTime - t_mlow) * unitTime);
-
-  Tle5012Sensor.getAngleRange(rr);
-  Tle5012Sensor.getAngleValue(a,ra);
-  Tle5012Sensor.getNumRevolutions(r);
-  Tle5012Sensor.getTemperature(t,rt);
-  Tle5012Sensor.getAngleSpeed(s,rs);
-
-  Serial.print("range:      ");  Serial.print(rr); Serial.println("°");
-  Serial.print("revolution: ");  Serial.println(r);
-
-  Serial.print("DIR\tangle:  "); Serial.print(a);  Serial.print("°   "); Serial.print(ra,HEX);
-  Serial.print("\ttemp:      "); Serial.print(t);  Serial.print("°C  "); Serial.print(rt,HEX);
-  Serial.print("\tspeed:     "); Serial.print(s);  Serial.print("°/s "); Serial.print(rs,HEX);
+  SPCDecoder::Frame_t frames[SENSORS] = {};
+
+  for (uint8_t i = 0; i < SENSORS; i++) {
+    checkError = spc.read(i, frames[i]);
+    if (checkError != NO_ERROR) {
+      Serial.print("ID ");        Serial.print(i);
+      Serial.print("\terror: "); Serial.println(checkError, HEX);
+      continue;
+    }
+    double a = (ANGLE_360_VAL / POW_2_15) * ((double) frames[i].rawAngle);
+    Serial.print("ID ");          Serial.print(i);
+    Serial.print("\tangle:  ");   Serial.print(a); Serial.print("°   "); Serial.print(frames[i].angle, HEX);
+    Serial.print("\tstatus: ");   Serial.print(frames[i].status, HEX);
+    Serial.print("\ttemp:   ");   Serial.println(frames[i].temperature, HEX);
+  }
+
+  const Tle5012bSPC::Stats_t &stats = spc.getStats();
+  Serial.print("frames: ");    Serial.print(stats.frames);
+  Serial.print("\ttimeouts: ");  Serial.print(stats.timeouts);
+  Serial.print("\tframe errors: "); Serial.print(stats.frameErrors);
+  Serial.print("\tcrc errors: ");   Serial.println(stats.crcErrors);
 
   Serial.println("\n");
   delay(1000);
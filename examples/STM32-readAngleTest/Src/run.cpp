@@ -13,7 +13,7 @@
 #include "SEGGER_RTT.h"
 #include <stdio.h>
 
-Tle5012Stm32 Tle5012Sensor = Tle5012Stm32(
+Tle5012Stm32 Tle5012Sensor(
 		// SPIbus,
 		(uint32_t) TLE5012_CS_Pin,
 		TLE5012_CS_GPIO_Port,
@@ -0,0 +1,120 @@
+/*!
+ * \name        electricalAngleBenchmark
+ * \author      Infineon Technologies AG
+ * \copyright   2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       Cycle and accuracy benchmark of the FOC output stage
+ * \details
+ * A FOC loop needs the electrical angle and its sine and cosine in every cycle.
+ * This example compares the integer output stage (Tle5012bFOC) with the usual
+ * getAngleValue, degree to radian conversion and libm sin/cos:
+ * - accuracy of the Q15 table sine/cosine over all 65536 angles
+ * - CPU cycles per conversion of both ways, without the SPI transfer
+ * - SPI read plus conversion of both ways with the sensor
+ * The cycle count is calculated from micros() and F_CPU, so it includes the loop overhead.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <TLE5012-ino.hpp>
+#include "corelib/tle5012b_foc.hpp"
+
+//!< \brief pole pairs of the motor
+#define POLE_PAIRS    7
+
+//!< \brief number of conversions for the timing
+#define RUNS          2000
+
+Tle5012Ino Tle5012Sensor;
+Tle5012bFOC foc(Tle5012Sensor);
+errorTypes checkError = NO_ERROR;
+
+volatile int32_t sinkInt = 0;
+volatile float sinkFloat = 0.0;
+
+void printCycles(const char *name, uint32_t us) {
+  Serial.print(name);
+  Serial.print((float) us * (F_CPU / 1000000UL) / RUNS);
+  Serial.println(" cycles");
+}
+
+void setup() {
+  delay(2000);
+  Serial.begin(115200);
+  while (!Serial) {};
+  checkError = Tle5012Sensor.begin();
+  Serial.print("checkError: ");
+  Serial.println(checkError,HEX);
+
+  foc.configure(POLE_PAIRS);
+  checkError = foc.align();
+
+  // accuracy of the table over all angles
+  int16_t s = 0;
+  int16_t c = 0;
+  float maxError = 0.0;
+  for (uint32_t a = 0; a < FOC_ELECTRICAL_FULL; a++) {
+    ElectricalAngle::sinCos((uint16_t) a, s, c);
+    float r = a * (2.0 * PI / FOC_ELECTRICAL_FULL);
+    float es = fabs(s - 32767.0 * sin(r));
+    float ec = fabs(c - 32767.0 * cos(r));
+    if (es > maxError) maxError = es;
+    if (ec > maxError) maxError = ec;
+  }
+  Serial.print("max sin/cos error: "); Serial.print(maxError); Serial.println(" LSB Q15");
+
+  // conversion only, raw angle to electrical angle with sine and cosine
+  uint32_t start = micros();
+  for (int16_t i = 0; i < RUNS; i++) {
+    uint16_t e = foc.angle().electrical(i * 16);
+    ElectricalAngle::sinCos(e, s, c);
+    sinkInt += s + c;
+  }
+  printCycles("table conversion:     ", micros() - start);
+
+  start = micros();
+  for (int16_t i = 0; i < RUNS; i++) {
+    float d = (ANGLE_360_VAL / POW_2_15) * (i * 16);
+    float r = d * POLE_PAIRS * (PI / 180.0);
+    sinkFloat += sin(r) + cos(r);
+  }
+  printCycles("libm conversion:      ", micros() - start);
+
+  // SPI read with conversion
+  Tle5012bFOC::Output_t out;
+  start = micros();
+  for (int16_t i = 0; i < RUNS; i++) {
+    foc.read(out);
+    sinkInt += out.sinValue + out.cosValue;
+  }
+  printCycles("table read+convert:   ", micros() - start);
+
+  double d = 0.0;
+  start = micros();
+  for (int16_t i = 0; i < RUNS; i++) {
+    Tle5012Sensor.getAngleValue(d);
+    float r = d * POLE_PAIRS * (PI / 180.0);
+    sinkFloat += sin(r) + cos(r);
+  }
+  printCycles("libm read+convert:    ", micros() - start);
+
+  Serial.println("Init done");
+}
+
+void loop() {
+  Tle5012bFOC::Output_t out;
+  checkError = foc.read(out);
+  if (checkError != NO_ERROR) {
+    Serial.print("checkError: "); Serial.println(checkError, HEX);
+    delay(500);
+    return;
+  }
+
+  Serial.print("raw: ");        Serial.print(out.rawAngle);
+  Serial.print("\telectrical: "); Serial.print(out.electrical * 360.0 / FOC_ELECTRICAL_FULL);
+  Serial.print("°\tsin: ");     Serial.print(out.sinValue);
+  Serial.print("\tcos: ");      Serial.println(out.cosValue);
+
+  delay(500);
+}
@@ -20,7 +20,7 @@
 
 
 // Tle5012b Object
-Tle5012Ino Tle5012MagneticAngleSensor = Tle5012Ino();
+Tle5012Ino Tle5012MagneticAngleSensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
@@ -24,7 +24,7 @@
 
 #include <TLE5012-ino.hpp>
 
-Tle5012Ino Tle5012Sensor = Tle5012Ino();
+Tle5012Ino Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 uint16_t command = 0x0050; //!< read register beginning with REG_FSYNC
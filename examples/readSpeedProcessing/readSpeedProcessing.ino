@@ -17,7 +17,7 @@
 
 #include <TLE5012-ino.hpp>
 
-Tle5012Ino Tle5012MagneticAngleSensor = Tle5012Ino();
+Tle5012Ino Tle5012MagneticAngleSensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
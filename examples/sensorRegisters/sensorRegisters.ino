@@ -35,8 +35,9 @@ void loop()
 
 #include <TLE5012-ino.hpp>
 #include "const.h"
+#include "corelib/tle5012b_shadow.hpp"
 
-Tle5012Ino Tle5012Sensor = Tle5012Ino();
+Tle5012Ino Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 
@@ -669,6 +670,27 @@ void show_ADC()
 
 
 
+/**
+ * @brief Function prints the configuration registers as binary image,
+ * which can be stored and written back with ConfigShadow::importImage
+ * and ConfigShadow::apply
+ */
+void show_IMAGE()
+{
+  ConfigShadow shadow;
+  uint8_t image[SHADOW_IMAGE_SIZE];
+  checkError = shadow.capture(Tle5012Sensor);
+  uint8_t length = ConfigShadow::exportImage(shadow.image(), SHADOW_VARIANT_UNKNOWN, image);
+
+  Serial.print("\nconfiguration image: ");
+  for (uint8_t i = 0; i < length; i++)
+  {
+    if (image[i] < 0x10) Serial.print("0");
+    Serial.print(image[i], HEX);
+  }
+  Serial.println();
+}
+
 void setup() {
   delay(1000);
   Serial.begin(115200);
@@ -693,6 +715,7 @@ void setup() {
   show_MOD4();
   show_TCOTY();
   show_ADC();
+  show_IMAGE();
 
   Serial.end();
 }
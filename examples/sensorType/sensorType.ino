@@ -20,7 +20,7 @@
 #include <TLE5012-ino.hpp>
 #include "const.h"
 
-Tle5012Ino Tle5012Sensor = Tle5012Ino();
+Tle5012Ino Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
@@ -71,6 +71,22 @@ void setup() {
   show_bin();
   show_identity();
   show_additional();
+
+  /*
+     The library identifies the variant also with one burst read
+     of MOD_1 to MOD_4, without the full register map.
+  */
+  Reg::sensorType_t type;
+  Reg::interfaceType_t iface;
+  checkError = Tle5012Sensor.readSensorType(type, iface);
+  Serial.print("readSensorType: ");
+  Serial.print(checkError, HEX);
+  Serial.print("\t");
+  Serial.print(sc_PCB);
+  Serial.print(type);
+  Serial.print("\t");
+  Serial.print(sc_Interface);
+  Serial.println(iface);
 }
 
 void loop() {
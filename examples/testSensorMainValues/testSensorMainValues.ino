@@ -17,7 +17,7 @@
 #include <TLE5012-ino.hpp>
 
 // Tle5012b Object
-Tle5012Ino Tle5012Sensor = Tle5012Ino();
+Tle5012Ino Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 updTypes upd = UPD_high;
 
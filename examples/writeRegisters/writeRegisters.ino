@@ -15,7 +15,7 @@
 
 #include <TLE5012-ino.hpp>
 
-Tle5012Ino Tle5012Sensor = Tle5012Ino();
+Tle5012Ino Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 bool s = true;
 
@@ -12,6 +12,7 @@
  */
 
 #include "TLE5012b.hpp"
+#include "tle5012b_shadow.hpp"
 
 //-----------------------------------------------------------------------------
 // none_class functions
@@ -118,6 +119,8 @@ Tle5012b::Tle5012b():reg(this)
 	en = NULL;
 	safetyWord = 0;
 	mSlave = TLE5012B_S0;
+	mDeterministic = false;
+	mSafetyPending = false;
 }
 
 Tle5012b::~Tle5012b()
@@ -130,7 +133,9 @@ Tle5012b::~Tle5012b()
 void Tle5012b::end(void)
 {
 	disableSensor();
-	sBus->deinit();
+	if (sBus != NULL) {
+		sBus->deinit();
+	}
 }
 
 void Tle5012b::enableSensor()
@@ -153,13 +158,17 @@ errorTypes Tle5012b::readFromSensor(uint16_t command, uint16_t &data, updTypes u
 {
 	errorTypes checkError = NO_ERROR;
 
-	_command[0] = READ_SENSOR | command | upd | safe;
+	uint16_t _cmd = READ_SENSOR | command | upd | safe;
 	uint16_t _received[MAX_REGISTER_MEM] = {0};
-	sBus->sendReceive(_command, 1, _received, 2);
+	if ((sBus->sendReceive(&_cmd, 1, _received, 2) != SPIC::OK) && mDeterministic)
+	{
+		data = 0;
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	data = _received[0];
 	if (safe == SAFE_high)
 	{
-		checkError = checkSafety(_received[1], _command[0], &_received[0], 1);
+		checkError = checkSafety(_received[1], _cmd, &_received[0], 1);
 		if (checkError != NO_ERROR)
 		{
 			data = 0;
@@ -172,17 +181,21 @@ errorTypes Tle5012b::readMoreRegisters(uint16_t command, uint16_t data[], updTyp
 {
 	errorTypes checkError = NO_ERROR;
 
-	_command[0] = READ_SENSOR | command | upd | safe;
+	uint16_t _cmd = READ_SENSOR | command | upd;
 	uint16_t _received[MAX_REGISTER_MEM] = {0};
-	uint16_t _recDataLength = (_command[0] & (0x000F)); // Number of registers to read
-	sBus->sendReceive(_command, 1, _received, _recDataLength + safe);
+	uint16_t _recDataLength = (_cmd & (0x000F)); // Number of registers to read, the safety word follows them
+	if ((sBus->sendReceive(&_cmd, 1, _received, _recDataLength + safe) != SPIC::OK) && mDeterministic)
+	{
+		memset(data, 0, (_recDataLength)* sizeof(uint16_t));
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	memcpy(data, _received, (_recDataLength)* sizeof(uint16_t));
 	if (safe == SAFE_high)
 	{
-		checkError = checkSafety(_received[_recDataLength], _command[0], _received, _recDataLength);
+		checkError = checkSafety(_received[_recDataLength], _cmd, _received, _recDataLength);
 		if (checkError != NO_ERROR)
 		{
-			data = 0;
+			memset(data, 0, (_recDataLength)* sizeof(uint16_t));
 		}
 	}
 	return (checkError);
@@ -191,16 +204,21 @@ errorTypes Tle5012b::readMoreRegisters(uint16_t command, uint16_t data[], updTyp
 errorTypes Tle5012b::writeToSensor(uint16_t command, uint16_t dataToWrite, bool changeCRC)
 {
 	uint16_t safety = 0;
-	_command[0] = WRITE_SENSOR | command | SAFE_high;
-	_command[1] = dataToWrite;
-	sBus->sendReceive(_command, 2, &safety, 1);
+	uint16_t _cmd[2] = {(uint16_t) (WRITE_SENSOR | command | SAFE_high), dataToWrite};
+	// no other task may write between the register and its CRC update
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	sBus->sendReceive(_cmd, 2, &safety, 1);
 
-	errorTypes checkError = checkSafety(safety, _command[0], &_command[1], 1);
+	errorTypes checkError = checkSafety(safety, _cmd[0], &_cmd[1], 1);
 	//if we write to a register, which changes the CRC.
 	if (changeCRC)
 	{
 		checkError = regularCrcUpdate();
 	}
+	sBus->unlock();
 	return (checkError);
 }
 
@@ -208,17 +226,21 @@ errorTypes Tle5012b::writeTempCoeffUpdate(uint16_t dataToWrite)
 {
 	uint16_t safety = 0;
 	uint16_t readreg = 0;
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	sBus->triggerUpdate();
-	_command[0] = WRITE_SENSOR | reg.REG_TCO_Y | SAFE_high;
-	_command[1] = dataToWrite;
-	sBus->sendReceive(_command, 2, &safety, 1);
-	errorTypes checkError = checkSafety(safety, _command[0], &_command[1], 1);
+	uint16_t _cmd[2] = {(uint16_t) (WRITE_SENSOR | reg.REG_TCO_Y | SAFE_high), dataToWrite};
+	sBus->sendReceive(_cmd, 2, &safety, 1);
+	errorTypes checkError = checkSafety(safety, _cmd[0], &_cmd[1], 1);
 	//
 	checkError = readStatus(readreg);
 	if (readreg & 0x0008)
 	{
 		checkError = regularCrcUpdate();
 	}
+	sBus->unlock();
 	return (checkError);
 }
 // end generic data transfer functions
@@ -227,6 +249,22 @@ errorTypes Tle5012b::writeTempCoeffUpdate(uint16_t dataToWrite)
 //-----------------------------------------------------------------------------
 // begin CRC functions
 errorTypes Tle5012b::checkSafety(uint16_t safety, uint16_t command, uint16_t* readreg, uint16_t length)
+{
+	errorTypes errorCheck = verifySafety(safety, command, readreg, length);
+	if ((errorCheck == SYSTEM_ERROR) || (errorCheck == CRC_ERROR))
+	{
+		if (mDeterministic)
+		{
+			// no hidden transaction, the caller schedules resetSafety
+			mSafetyPending = true;
+		}else{
+			resetSafety();
+		}
+	}
+	return (errorCheck);
+}
+
+errorTypes Tle5012b::verifySafety(uint16_t safety, uint16_t command, const uint16_t* readreg, uint16_t length)
 {
 	errorTypes errorCheck;
 	safetyWord = safety;
@@ -235,7 +273,6 @@ errorTypes Tle5012b::checkSafety(uint16_t safety, uint16_t command, uint16_t* re
 	if (!((safety) & SYSTEM_ERROR_MASK))
 	{
 		errorCheck = SYSTEM_ERROR;
-		resetSafety();
 	} else if (!((safety) & INTERFACE_ERROR_MASK))
 	{
 		errorCheck = INTERFACE_ACCESS_ERROR;
@@ -266,7 +303,6 @@ errorTypes Tle5012b::checkSafety(uint16_t safety, uint16_t command, uint16_t* re
 			errorCheck = NO_ERROR;
 		}else{
 			errorCheck = CRC_ERROR;
-			resetSafety();
 		}
 	}
 	return (errorCheck);
@@ -276,8 +312,14 @@ void Tle5012b::resetSafety()
 {
 	uint16_t command = READ_SENSOR + SAFE_high;
 	uint16_t receive[4];
+	if (sBus->lock() != SPIC::OK)
+	{
+		return;
+	}
 	sBus->triggerUpdate();
 	sBus->sendReceive(&command, 1, receive, 3);
+	sBus->unlock();
+	mSafetyPending = false;
 }
 
 errorTypes Tle5012b::resetFirmware()
@@ -289,6 +331,11 @@ errorTypes Tle5012b::resetFirmware()
 
 errorTypes Tle5012b::regularCrcUpdate()
 {
+	// the CRC block must not change between the read and the TCO_Y write
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	readBlockCRC();
 	uint8_t temp[16];
 	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
@@ -302,7 +349,9 @@ errorTypes Tle5012b::regularCrcUpdate()
 	uint16_t valToSend = (firstTempByte << 8) | secondTempByte;
 	_registers[7] = valToSend;
 
-	return (writeTempCoeffUpdate(valToSend));
+	errorTypes checkError = writeTempCoeffUpdate(valToSend);
+	sBus->unlock();
+	return (checkError);
 }
 // end CRC functions
 
@@ -311,11 +360,65 @@ errorTypes Tle5012b::regularCrcUpdate()
 // begin read functions
 errorTypes Tle5012b::readBlockCRC()
 {
-	_command[0] = READ_BLOCK_CRC;
-	_registers[CRC_NUM_REGISTERS + 1] = {0};  // Number of CRC Registers + 1 Register for Safety word
-	sBus->sendReceive(_command, 1, _registers, CRC_NUM_REGISTERS+1);
+	uint16_t _cmd = READ_BLOCK_CRC;
+	memset(_registers, 0, sizeof(_registers));  // Number of CRC Registers + 1 Register for Safety word
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	sBus->sendReceive(&_cmd, 1, _registers, CRC_NUM_REGISTERS+1);
 	errorTypes checkError = checkSafety(_registers[8], READ_BLOCK_CRC, _registers, CRC_NUM_REGISTERS);
-	resetSafety();
+	// the block read is followed by a reset of the safety status, in deterministic mode by the caller
+	if (mDeterministic)
+	{
+		mSafetyPending = true;
+	}else{
+		resetSafety();
+	}
+	sBus->unlock();
+	return (checkError);
+}
+
+errorTypes Tle5012b::applyConfigBlock(const uint16_t configImage[], uint8_t *writes)
+{
+	ConfigShadow::Image_t current;
+	ConfigShadow::Image_t target;
+	ConfigShadow::Write_t list[SHADOW_REGISTERS];
+	uint8_t count = 0;
+
+	// only the CRC block is compared, the other shadow registers are equal
+	memset(&target, 0, sizeof(target));
+	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
+	{
+		target.regs[SHADOW_CRC_FIRST + i] = configImage[i];
+	}
+	ConfigShadow::seal(target);
+	current = target;
+
+	// one read of the CRC block, the writes below do not need an update cycle
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	errorTypes checkError = readMoreRegisters(reg.REG_MOD_2 | CRC_NUM_REGISTERS, &current.regs[SHADOW_CRC_FIRST], UPD_low, SAFE_high);
+	if (checkError == NO_ERROR)
+	{
+		count = ConfigShadow::diff(current, target, list);
+		checkError = ConfigShadow::write(*this, list, count);
+	}
+	if (checkError == NO_ERROR)
+	{
+		// the cached block stays valid for later CRC updates
+		for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
+		{
+			_registers[i] = target.regs[SHADOW_CRC_FIRST + i];
+		}
+	}
+	sBus->unlock();
+	if (writes != NULL)
+	{
+		*writes = count;
+	}
 	return (checkError);
 }
 
@@ -413,7 +516,10 @@ errorTypes Tle5012b::readRawY(int16_t &data)
 errorTypes Tle5012b::getAngleValue(double &angleValue)
 {
 	int16_t rawAnglevalue = 0;
-	return (getAngleValue(angleValue, rawAnglevalue, UPD_low, SAFE_high));
+	safetyTypes safe = safetyPolicy.next();
+	errorTypes status = getAngleValue(angleValue, rawAnglevalue, UPD_low, safe);
+	safetyPolicy.record(safe, status);
+	return (status);
 }
 errorTypes Tle5012b::getAngleValue(double &angleValue, int16_t &rawAnglevalue, updTypes upd, safetyTypes safe)
 {
@@ -437,7 +543,10 @@ errorTypes Tle5012b::getAngleValue(double &angleValue, int16_t &rawAnglevalue, u
 errorTypes Tle5012b::getTemperature(double &temperature)
 {
 	int16_t rawTemp = 0;
-	return (getTemperature(temperature, rawTemp, UPD_low, SAFE_high));
+	safetyTypes safe = safetyPolicy.next();
+	errorTypes status = getTemperature(temperature, rawTemp, UPD_low, safe);
+	safetyPolicy.record(safe, status);
+	return (status);
 }
 errorTypes Tle5012b::getTemperature(double &temperature, int16_t &rawTemp, updTypes upd, safetyTypes safe)
 {
@@ -479,7 +588,10 @@ errorTypes Tle5012b::getNumRevolutions(int16_t &numRev, updTypes upd, safetyType
 errorTypes Tle5012b::getAngleSpeed(double &finalAngleSpeed)
 {
 	int16_t rawSpeed = 0;
-	return (getAngleSpeed(finalAngleSpeed, rawSpeed, UPD_low, SAFE_high));
+	safetyTypes safe = safetyPolicy.next();
+	errorTypes status = getAngleSpeed(finalAngleSpeed, rawSpeed, UPD_low, safe);
+	safetyPolicy.record(safe, status);
+	return (status);
 }
 errorTypes Tle5012b::getAngleSpeed(double &finalAngleSpeed, int16_t &rawSpeed, updTypes upd, safetyTypes safe)
 {
@@ -523,7 +635,6 @@ errorTypes Tle5012b::getAngleSpeed(double &finalAngleSpeed, int16_t &rawSpeed, u
 	//checks the value of fir_MD according to which the value in the calculation of the speed will be determined
 	//according to if prediction is enabled then, the formula for speed changes
 	finalAngleSpeed = calculateAngleSpeed(angleRange, rawSpeed, firMDVal, intMode2Prediction);
-	_command[0] = 0; // Have to access _command variable, else somehow when the function exits the pointer will change
 	return (status);
 }
 
@@ -594,27 +705,152 @@ errorTypes Tle5012b::writeSlaveNumber(uint16_t dataToWrite)
 {
 	return(writeToSensor(WRITE_SENSOR, dataToWrite, false));
 }
+
+errorTypes Tle5012b::applySlaveNumber(uint16_t slave, bool *written)
+{
+	uint16_t stat = 0;
+	errorTypes checkError = readStatus(stat);
+	bool differs = (checkError != NO_ERROR) || ((stat & Reg::REG_STAT_SNR::mask) != (slave & Reg::REG_STAT_SNR::mask));
+	if (differs)
+	{
+		checkError = writeSlaveNumber(slave);
+	}
+	if (written != NULL)
+	{
+		*written = differs;
+	}
+	return (checkError);
+}
 // end write functions
 
 errorTypes Tle5012b::readRegMap()
 {
-	errorTypes status;
+	errorTypes status = NO_ERROR;
+	errorTypes burstStatus = NO_ERROR;
+	int8_t first = 0;
+	int8_t last = 0;
 
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	sBus->triggerUpdate();
-	for (int8_t i = 0; i < MAX_NUM_REG; i++)
+	while (first < MAX_NUM_REG)
 	{
-		status = readFromSensor(reg.addrFields[i].regAddress, reg.regMap[i], UPD_low, SAFE_high);
+		// extend the burst as long as the register addresses are contiguous
+		last = first;
+		while ((last + 1 < MAX_NUM_REG)
+			&& (last - first + 1 < MAX_BURST_LENGTH)
+			&& (reg.addrFields[last + 1].regAddress == reg.addrFields[last].regAddress + REG_ADDRESS_STEP))
+		{
+			last++;
+		}
+
+		burstStatus = readMoreRegisters(reg.addrFields[first].regAddress | (last - first + 1), &reg.regMap[first], UPD_low, SAFE_high);
+		if (burstStatus != NO_ERROR)
+		{
+			// fall back to single reads so only the failing registers are lost
+			for (int8_t i = first; i <= last; i++)
+			{
+				burstStatus = readFromSensor(reg.addrFields[i].regAddress, reg.regMap[i], UPD_low, SAFE_high);
+				if ((burstStatus != NO_ERROR) && (status == NO_ERROR))
+				{
+					status = burstStatus;
+				}
+			}
+		}
+		first = last + 1;
 	}
+	sBus->unlock();
 
 	return (status);
 }
 
+errorTypes Tle5012b::readSensorType(Reg::sensorType_t &type, Reg::interfaceType_t &iface)
+{
+	// MOD_1 to MOD_4 are the regMap entries 6 to 14
+	uint16_t *data = &reg.regMap[Reg::REG_MOD_1 / REG_ADDRESS_STEP];
+	errorTypes status = readMoreRegisters(Reg::REG_MOD_1 | TYPE_BURST_LENGTH, data, UPD_low, SAFE_high);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	uint16_t mod4 = reg.regMap[Reg::REG_MOD_4 / REG_ADDRESS_STEP];
+	iface = (Reg::interfaceType_t) Reg::REG_MOD_4_IFMD::extract(mod4);
+	if (!Reg::identify(mod4, reg.regMap[Reg::REG_IFAB / REG_ADDRESS_STEP], type))
+	{
+		return (SYSTEM_ERROR);
+	}
+	return (NO_ERROR);
+}
+
+errorTypes Tle5012b::probeSpeed(uint32_t &speed, uint32_t maxSpeed)
+{
+	uint16_t reference[SPEED_PROBE_LENGTH] = {0};
+	uint16_t data[SPEED_PROBE_LENGTH] = {0};
+	uint32_t start = sBus->getClock();
+	uint32_t passed = start;
+	uint32_t settled = start;
+	bool failed = false;
+
+	speed = start;
+	// the clock is shared, other tasks must not see the probe steps
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	if ((start == 0) || (sBus->setClock(start) != SPIC::OK))
+	{
+		sBus->unlock();
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	errorTypes status = readMoreRegisters(reg.REG_MOD_1 | SPEED_PROBE_LENGTH, reference, UPD_low, SAFE_high);
+	if (status != NO_ERROR)
+	{
+		sBus->unlock();
+		return (status);
+	}
+
+	for (uint32_t clock = start + SPEED_PROBE_STEP; (clock <= maxSpeed) && !failed; clock += SPEED_PROBE_STEP)
+	{
+		sBus->setClock(clock);
+		for (uint8_t i = 0; (i < SPEED_PROBE_READS) && !failed; i++)
+		{
+			if ((readMoreRegisters(reg.REG_MOD_1 | SPEED_PROBE_LENGTH, data, UPD_low, SAFE_high) != NO_ERROR)
+				|| (memcmp(data, reference, sizeof(reference)) != 0))
+			{
+				failed = true;
+			}
+		}
+		if (!failed)
+		{
+			settled = passed;
+			passed = clock;
+		}
+	}
+
+	// without any error the last clock is used, otherwise keep one step of margin
+	if (!failed)
+	{
+		settled = passed;
+	}
+	sBus->setClock(settled);
+	speed = sBus->getClock();
+	sBus->unlock();
+	return (NO_ERROR);
+}
+
 errorTypes Tle5012b::writeInterfaceType(Reg::interfaceType_t iface)
 {
 	uint16_t rawData = 0;
 
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	errorTypes status = readIntMode4(rawData);
 	if (status != NO_ERROR) {
+		sBus->unlock();
 		return (status);
 	}
 
@@ -622,6 +858,7 @@ errorTypes Tle5012b::writeInterfaceType(Reg::interfaceType_t iface)
 	rawData &= ~(1UL << 1);
 	rawData = rawData | iface;
 	status = writeIntMode4(rawData);
+	sBus->unlock();
 
 	return (status);
 }
@@ -630,8 +867,13 @@ errorTypes Tle5012b::setCalibration(Reg::calibrationMode_t calMode)
 {
 	uint16_t rawData = 0;
 
+	if (sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
 	errorTypes status = readIntMode2(rawData);
 	if (status != NO_ERROR) {
+		sBus->unlock();
 		return (status);
 	}
 
@@ -639,6 +881,7 @@ errorTypes Tle5012b::setCalibration(Reg::calibrationMode_t calMode)
 	rawData &= ~(1UL << 1);
 	rawData = rawData | calMode;
 	status = writeIntMode2(rawData);
+	sBus->unlock();
 
 	return (status);
 }
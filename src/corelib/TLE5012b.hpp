@@ -19,6 +19,7 @@
 #include "../pal/spic.hpp"
 #include "tle5012b_util.hpp"
 #include "tle5012b_reg.hpp"
+#include "tle5012b_safety.hpp"
 
 /**
  * @addtogroup tle5012api
@@ -48,6 +49,9 @@ class Tle5012b
 		GPIO     *en;                //!< \brief shield enable GPIO to switch sensor2go on/off
 		Reg      reg;                //!< \brief Register map
 		slaveNum mSlave;             //!< \brief actual set slave number
+		SafetyPolicy safetyPolicy;   //!< \brief safety word selection of the convenience getters
+		bool     mDeterministic;     //!< \brief deterministic reads: one transaction per read, bus errors fail fast, no resetSafety inside
+		bool     mSafetyPending;     //!< \brief a resetSafety was skipped in deterministic mode and is due
 
 		struct safetyWord {  //!< \brief Safety word bit setting
 			bool STAT_RES;           //!< \brief bits 15:15 Indication of chip reset or watchdog overflow
@@ -91,6 +95,10 @@ class Tle5012b
 		//!< \brief destructor stops the Sensor
 		~Tle5012b();
 
+		//!< \brief no copies, reg, sBus and en point into the sensor object
+		Tle5012b(const Tle5012b &) = delete;
+		Tle5012b &operator=(const Tle5012b &) = delete;
+
 		//!< \brief default begin with standard pin setting
 		errorTypes begin();
 
@@ -120,10 +128,23 @@ class Tle5012b
 		/*!
 		* Reads the block of _registers from addresses 08 - 0F in order to figure out the CRC.
 		* ATTENTION: You need a memory chunk of unit16_t * CRC Registers + 1 * uint16_t for the safety word.
+		* The safety status is reset afterwards, in deterministic mode only mSafetyPending is set.
 		* @return CRC error type
 		*/
 		errorTypes readBlockCRC();
 
+		/*!
+		* Fast boot check of the configuration. Reads the block of _registers from
+		* addresses 08 - 0F once and compares it with the expected image and its CRC
+		* with ConfigShadow::diff. Only differing _registers are written by
+		* ConfigShadow::write, 0F as the last one with the CRC calculated from the
+		* image, so no CRC update cycle is needed.
+		* @param [in] configImage expected values of the CRC_NUM_REGISTERS _registers 08 - 0F, the CRC byte of 0F is calculated
+		* @param [out] writes optional number of written _registers
+		* @return CRC error type
+		*/
+		errorTypes applyConfigBlock(const uint16_t configImage[], uint8_t *writes=NULL);
+
 		/*!
 		* General read function for reading _registers from the Tle5012b.
 		*
@@ -223,6 +244,7 @@ class Tle5012b
 		/*!
 		* Returns the angleValue calculated on the base of a 15 bit signed integer.
 		* However, the register returns 16 bits, so we need to do some bit arithmetic.
+		* The safety word is requested as selected by safetyPolicy.
 		* @param [in,out] angleValue pointer to 16bit double angle value
 		* @return CRC error type
 		*/
@@ -253,6 +275,7 @@ class Tle5012b
 		* Return the temperature.
 		* The temperature value is a 9 bit signed integer.
 		* However, the register returns 16 bits, so we need to do some bit arithmetic.
+		* The safety word is requested as selected by safetyPolicy.
 		* @param [in,out] temp pointer to 16bit double value of the temperature
 		* @return CRC error type
 		*/
@@ -271,6 +294,7 @@ class Tle5012b
 		* Returns the calculated angle speed.
 		* The angle speed is a 15 bit signed integer,
 		* however, the register returns 16 bits, so we need to do some bit arithmetic.
+		* The safety word is requested as selected by safetyPolicy.
 		* @param [in,out] angleSpeed pointer to 16bit double value
 		* @return CRC error type
 		*/
@@ -292,6 +316,15 @@ class Tle5012b
 		*/
 		errorTypes writeSlaveNumber(uint16_t dataToWrite);
 
+		/*!
+		* Reads the slave number from STAT and writes it only if it differs,
+		* so a warm boot with an unchanged slave number needs no write
+		* @param [in] slave slave number as set with writeSlaveNumber
+		* @param [out] written optional true if the slave number was written
+		* @return CRC error type
+		*/
+		errorTypes applySlaveNumber(uint16_t slave, bool *written=NULL);
+
 		/*!
 		* General write function for writing registers to the Tle5012b. The safety flag will be
 		* set always and only some of all registers are writable. See documentation for further information.
@@ -340,10 +373,37 @@ class Tle5012b
 		* Function reads all readable sensor registers
 		* and separates the information fields. This function
 		* is needed for finding the selected interface type.
-		* @return CRC error type
+		* Contiguous registers are fetched with one readMoreRegisters burst
+		* and one CRC check each. Only a burst which fails is read again
+		* register by register.
+		* @return CRC error type, the first error of all fallback reads
 		*/
 		errorTypes readRegMap();
 
+		/*!
+		* Identifies the sensor variant and the interface with one burst
+		* read of MOD_1 to MOD_4, which are also stored in reg.regMap.
+		* The interface is the actual IFMD setting, which is the fuse
+		* preset after a reset.
+		* @param [out] type sensor variant
+		* @param [out] iface interface mode
+		* @return CRC error type, SYSTEM_ERROR if no variant matches
+		*/
+		errorTypes readSensorType(Reg::sensorType_t &type, Reg::interfaceType_t &iface);
+
+		/*!
+		* Function probes the fastest reliable SPI clock. Starting from the
+		* actual clock, the clock is stepped up by SPEED_PROBE_STEP and at each step
+		* SPEED_PROBE_READS CRC checked bursts of the configuration registers are
+		* compared with a reference read at the start clock. At the first failing
+		* step the probe stops and settles one step below the last error free clock
+		* as margin. Needs a SPIC which supports setClock.
+		* @param [out] speed settled SPI clock in Hz
+		* @param [in] maxSpeed upper limit of the probe, default is the sensor maximum
+		* @return CRC error type, INTERFACE_ACCESS_ERROR if the clock can not be changed
+		*/
+		errorTypes probeSpeed(uint32_t &speed, uint32_t maxSpeed=SPI_SPEED_MAX);
+
 		/*!
 		* Functions switches between all possible interface types.
 		* ATTENTION: The different interfaces support not always all
@@ -364,9 +424,31 @@ class Tle5012b
 		*/
 		errorTypes setCalibration(Reg::calibrationMode_t calMode);
 
+		/*!
+		* checks the safety word and the CRC of a received frame like checkSafety,
+		* but without any bus access, so it can run while another frame is on the
+		* wire. After a SYSTEM_ERROR or CRC_ERROR the caller has to call resetSafety
+		* once the bus is free.
+		* @param safety register with the CRC check data
+		* @param command the command word of the frame
+		* @param readreg pointer to the read data
+		* @param length the length of the data structure
+		* @return CRC error type
+		*/
+		errorTypes verifySafety(uint16_t safety, uint16_t command, const uint16_t* readreg, uint16_t length);
+
+		/*!
+		* When an error occurs in the safety word, the error bit remains 0(error),
+		* until the status register is read again. Flushes out safety errors,
+		* that might have occurred by reading the register without a safety word.
+		* In case the safety word sends an error, this function is
+		* called so that the error bit is reset to 1. In deterministic
+		* mode the caller calls it when mSafetyPending is set.
+		*/
+		void resetSafety();
+
 	protected:
 
-		uint16_t _command[2];                      //!< \brief  command write data [0] = command [1] = data to write
 		uint16_t _received[MAX_REGISTER_MEM];      //!< \brief fetched data from sensor with last word = safety word
 		uint16_t _registers[CRC_NUM_REGISTERS+1];  //!< \brief keeps track of the values stored in the 8 _registers, for which the CRC is calculated
 
@@ -381,7 +463,8 @@ class Tle5012b
 
 		/*!
 		* checks the safety by looking at the safety word and calculating
-		* the CRC such that the data received is valid
+		* the CRC such that the data received is valid. Calls resetSafety
+		* on a system or CRC error, in deterministic mode it only sets mSafetyPending.
 		* @param safety register with the CRC check data
 		* @param command the command to execute the write
 		* @param readreg pointer to the read data
@@ -390,15 +473,6 @@ class Tle5012b
 		*/
 		errorTypes checkSafety(uint16_t safety, uint16_t command, uint16_t* readreg, uint16_t length);
 
-		/*!
-		* When an error occurs in the safety word, the error bit remains 0(error),
-		* until the status register is read again. Flushes out safety errors,
-		* that might have occurred by reading the register without a safety word.
-		* In case the safety word sends an error, this function is
-		* called so that the error bit is reset to 1.
-		*/
-		void resetSafety();
-
 };
 
 /**
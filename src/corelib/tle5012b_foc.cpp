@@ -0,0 +1,170 @@
+/*!
+ * \file        tle5012b_foc.cpp
+ * \name        tle5012b_foc.cpp - electrical angle and sin/cos output for FOC loops.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_foc.hpp"
+
+//!< \brief Q15 sine of the first quarter wave in 64 steps
+static const int16_t sineTable[(1 << FOC_TABLE_BITS) + 1] = {
+	    0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+	 6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767
+};
+
+/*!
+ * Interpolated sine of the first quarter wave
+ * @param [in] x angle 0 to FOC_QUARTER
+ * @return sine in Q15
+ */
+static int16_t quarterSine(uint16_t x)
+{
+	uint8_t index = (uint8_t) (x >> 8);
+	uint8_t frac = (uint8_t) (x & 0xFF);
+	int16_t base = sineTable[index];
+	if (frac == 0)
+	{
+		return (base);
+	}
+	// the table rises in the quarter, so the step is never negative
+	uint16_t step = (uint16_t) (sineTable[index + 1] - base);
+	return ((int16_t) (base + (int16_t) (((uint32_t) step * frac) >> 8)));
+}
+
+ElectricalAngle::ElectricalAngle():
+	polePairs_(1),
+	offset_(0)
+{
+}
+
+void ElectricalAngle::configure(uint8_t polePairs, int16_t rawOffset)
+{
+	polePairs_ = (polePairs == 0) ? 1 : polePairs;
+	setOffset(rawOffset);
+}
+
+void ElectricalAngle::setOffset(int16_t rawOffset)
+{
+	offset_ = (uint16_t) ((uint16_t) rawOffset << 1);
+}
+
+void ElectricalAngle::setAngleBase(uint16_t base)
+{
+	offset_ = (uint16_t) ((base & 0x0FFF) << 4);
+}
+
+void ElectricalAngle::align(int16_t rawAngle)
+{
+	setOffset(rawAngle);
+}
+
+int16_t ElectricalAngle::getOffset() const
+{
+	return ((int16_t) offset_ >> 1);
+}
+
+uint8_t ElectricalAngle::getPolePairs() const
+{
+	return (polePairs_);
+}
+
+uint16_t ElectricalAngle::electrical(int16_t rawAngle) const
+{
+	// 15 bit raw angle to 16 bit, the wrap around of uint16_t is one revolution
+	uint16_t mechanical = (uint16_t) (((uint16_t) rawAngle << 1) - offset_);
+	return ((uint16_t) (mechanical * polePairs_));
+}
+
+int16_t ElectricalAngle::sine(uint16_t angle)
+{
+	uint16_t x = angle & (FOC_QUARTER - 1);
+	switch (angle >> 14)
+	{
+		case 0:
+			return (quarterSine(x));
+		case 1:
+			return (quarterSine(FOC_QUARTER - x));
+		case 2:
+			return (-quarterSine(x));
+		default:
+			return (-quarterSine(FOC_QUARTER - x));
+	}
+}
+
+void ElectricalAngle::sinCos(uint16_t angle, int16_t &sinValue, int16_t &cosValue)
+{
+	sinValue = sine(angle);
+	cosValue = sine((uint16_t) (angle + FOC_QUARTER));
+}
+
+
+Tle5012bFOC::Tle5012bFOC(Tle5012b &sensor):
+	sensor_(sensor)
+{
+}
+
+void Tle5012bFOC::configure(uint8_t polePairs, int16_t rawOffset)
+{
+	angle_.configure(polePairs, rawOffset);
+}
+
+errorTypes Tle5012bFOC::readRaw(int16_t &rawAngle, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData = 0;
+	errorTypes status = sensor_.readFromSensor(sensor_.reg.REG_AVAL, rawData, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	rawData = (rawData & (DELETE_BIT_15));
+	if (rawData & (CHECK_BIT_14))
+	{
+		rawData = rawData - (CHANGE_UINT_TO_INT_15);
+	}
+	rawAngle = (int16_t) rawData;
+	return (status);
+}
+
+errorTypes Tle5012bFOC::align()
+{
+	int16_t rawAngle = 0;
+	errorTypes status = readRaw(rawAngle, UPD_low, SAFE_high);
+	if (status == NO_ERROR)
+	{
+		angle_.align(rawAngle);
+	}
+	return (status);
+}
+
+errorTypes Tle5012bFOC::read(Output_t &out, updTypes upd, safetyTypes safe)
+{
+	int16_t rawAngle = 0;
+	errorTypes status = readRaw(rawAngle, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	out.rawAngle = rawAngle;
+	out.electrical = angle_.electrical(rawAngle);
+	ElectricalAngle::sinCos(out.electrical, out.sinValue, out.cosValue);
+	return (status);
+}
+
+ElectricalAngle &Tle5012bFOC::angle()
+{
+	return (angle_);
+}
@@ -0,0 +1,156 @@
+/*!
+ * \file        tle5012b_foc.hpp
+ * \name        tle5012b_foc.hpp - electrical angle and sin/cos output for FOC loops.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              Field oriented control needs the electrical rotor angle and its sine and
+ *              cosine in every control cycle. ElectricalAngle converts the raw 15 bit AVAL
+ *              value with the pole pairs and a mechanical offset into a 16 bit electrical
+ *              angle (0x10000 is 360°, the same scale than the HSM decoder) and returns
+ *              Q15 sine and cosine from a quarter wave table with linear interpolation.
+ *              All math is integer, which avoids the double conversion of getAngleValue
+ *              and the libm calls on cores without FPU.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_FOC_HPP
+#define TLE5012B_FOC_HPP
+
+#include "TLE5012b.hpp"
+
+#define FOC_ELECTRICAL_FULL     0x10000UL   //!< \brief electrical angle of one electrical revolution
+#define FOC_QUARTER             0x4000U     //!< \brief electrical angle of 90°
+#define FOC_TABLE_BITS          6U          //!< \brief quarter wave table has 2^FOC_TABLE_BITS + 1 entries
+
+/**
+ * @addtogroup tle5012foc
+ *
+ * @{
+ */
+
+class ElectricalAngle
+{
+	public:
+
+		ElectricalAngle();
+
+		/*!
+		* Sets the pole pairs and the mechanical offset
+		* @param [in] polePairs pole pairs of the motor
+		* @param [in] rawOffset signed 15 bit raw angle of the electrical 0° position
+		*/
+		void configure(uint8_t polePairs, int16_t rawOffset=0);
+
+		/*!
+		* Sets the mechanical offset
+		* @param [in] rawOffset signed 15 bit raw angle of the electrical 0° position
+		*/
+		void setOffset(int16_t rawOffset);
+
+		/*!
+		* Sets the mechanical offset in the unit of the sensor angle base,
+		* so an offset found with setAngleBase can be kept in software
+		* @param [in] base 12 bit angle base value like ANG_BASE of MOD_3
+		*/
+		void setAngleBase(uint16_t base);
+
+		/*!
+		* Sets the offset so that the actual position is electrical 0°,
+		* e.g. after the rotor was locked with current on the d axis
+		* @param [in] rawAngle signed 15 bit raw angle value of AVAL
+		*/
+		void align(int16_t rawAngle);
+
+		//!< \brief returns the mechanical offset as signed 15 bit raw angle
+		int16_t getOffset() const;
+
+		//!< \brief returns the pole pairs
+		uint8_t getPolePairs() const;
+
+		/*!
+		* Converts a raw angle into the electrical angle
+		* @param [in] rawAngle signed 15 bit raw angle value of AVAL
+		* @return electrical angle, FOC_ELECTRICAL_FULL is 360°
+		*/
+		uint16_t electrical(int16_t rawAngle) const;
+
+		/*!
+		* Q15 sine from the quarter wave table
+		* @param [in] angle angle, FOC_ELECTRICAL_FULL is 360°
+		* @return sine in Q15, -32767 to 32767
+		*/
+		static int16_t sine(uint16_t angle);
+
+		/*!
+		* Q15 sine and cosine from the quarter wave table
+		* @param [in] angle angle, FOC_ELECTRICAL_FULL is 360°
+		* @param [out] sinValue sine in Q15
+		* @param [out] cosValue cosine in Q15
+		*/
+		static void sinCos(uint16_t angle, int16_t &sinValue, int16_t &cosValue);
+
+	private:
+
+		uint8_t     polePairs_;     //!< \brief pole pairs of the motor
+		uint16_t    offset_;        //!< \brief mechanical offset, 0x10000 is 360°
+};
+
+class Tle5012bFOC
+{
+	public:
+
+		//!< \brief output of one read
+		struct Output_t
+		{
+			int16_t  rawAngle;       //!< \brief signed 15 bit raw angle value of AVAL
+			uint16_t electrical;     //!< \brief electrical angle, FOC_ELECTRICAL_FULL is 360°
+			int16_t  sinValue;       //!< \brief sine of the electrical angle in Q15
+			int16_t  cosValue;       //!< \brief cosine of the electrical angle in Q15
+		};
+
+		Tle5012bFOC(Tle5012b &sensor);
+
+		/*!
+		* Sets the pole pairs and the mechanical offset
+		* @param [in] polePairs pole pairs of the motor
+		* @param [in] rawOffset signed 15 bit raw angle of the electrical 0° position
+		*/
+		void configure(uint8_t polePairs, int16_t rawOffset=0);
+
+		/*!
+		* Reads AVAL and sets the actual position as electrical 0°
+		* @return CRC error type, the offset is unchanged on error
+		*/
+		errorTypes align();
+
+		/*!
+		* Reads AVAL and calculates the electrical angle with sine and cosine
+		* @param [out] out raw, electrical angle and Q15 sine and cosine
+		* @param [in] upd read from update (UPD_high) or current (UPD_low) register
+		* @param [in] safe generate safety word (SAFE_high) or no (SAFE_low)
+		* @return CRC error type, out is unchanged on error
+		*/
+		errorTypes read(Output_t &out, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		//!< \brief the conversion with pole pairs and offset
+		ElectricalAngle &angle();
+
+	private:
+
+		Tle5012b        &sensor_;   //!< \brief sensor with SSC access
+		ElectricalAngle angle_;     //!< \brief electrical angle conversion
+
+		errorTypes readRaw(int16_t &rawAngle, updTypes upd, safetyTypes safe);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_FOC_HPP */
@@ -0,0 +1,226 @@
+/*!
+ * \file        tle5012b_health.cpp
+ * \name        tle5012b_health.cpp - magnet and sensor health monitor for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "tle5012b_health.hpp"
+
+//!< \brief number of registers from D_MAG to T_RAW
+#define HEALTH_BURST_LENGTH     2U
+
+/*!
+ * Clamps an EWMA difference into int16_t
+ */
+static int16_t toDrift(int32_t drift)
+{
+	drift = drift >> HEALTH_EWMA_FRACTION;
+	if (drift > INT16_MAX)
+	{
+		return (INT16_MAX);
+	}
+	if (drift < INT16_MIN)
+	{
+		return (INT16_MIN);
+	}
+	return ((int16_t) drift);
+}
+
+Tle5012bHealth::Tle5012bHealth(Tle5012b &sensor):
+	sensor_(sensor),
+	interval_(HEALTH_INTERVAL),
+	countdown_(HEALTH_INTERVAL)
+{
+	limits_.magMin = 0;
+	limits_.magMax = 0;
+	limits_.magDrift = 0;
+	limits_.tempDrift = 0;
+	limits_.errorRate = 0;
+	clearStats();
+}
+
+void Tle5012bHealth::setInterval(uint16_t interval)
+{
+	interval_ = interval;
+	countdown_ = interval;
+}
+
+void Tle5012bHealth::setLimits(const Limits_t &limits)
+{
+	limits_ = limits;
+}
+
+errorTypes Tle5012bHealth::record(errorTypes status)
+{
+	int32_t target = (status == NO_ERROR) ? 0 : HEALTH_RATE_FULL;
+	stats_.reads++;
+	if (status != NO_ERROR)
+	{
+		stats_.errors++;
+	}
+	errorRate_ = (uint32_t) ((int32_t) errorRate_ + ((target - (int32_t) errorRate_) >> HEALTH_RATE_SHIFT));
+
+	if ((interval_ == 0) || (--countdown_ != 0))
+	{
+		return (NO_ERROR);
+	}
+	countdown_ = interval_;
+	return (poll());
+}
+
+errorTypes Tle5012bHealth::poll()
+{
+	uint16_t data[HEALTH_BURST_LENGTH];
+	errorTypes status = sensor_.readMoreRegisters(Reg::REG_D_MAG | HEALTH_BURST_LENGTH, data, UPD_low, SAFE_high);
+	stats_.polls++;
+	if (status != NO_ERROR)
+	{
+		stats_.pollErrors++;
+		return (status);
+	}
+	add(data[0], data[1]);
+	return (NO_ERROR);
+}
+
+void Tle5012bHealth::add(uint16_t dmag, uint16_t traw)
+{
+	update(mag_, Reg::REG_D_MAG_MAG::extract(dmag));
+	update(temp_, Reg::REG_T_RAW_TRAW::extract(traw));
+	if (!learned_ && (mag_.count >= learn_))
+	{
+		learn(0);
+	}
+}
+
+void Tle5012bHealth::update(Channel_t &channel, uint16_t value)
+{
+	int32_t scaled = ((int32_t) value) << HEALTH_EWMA_FRACTION;
+	if (channel.count == 0)
+	{
+		channel.min = value;
+		channel.max = value;
+		channel.ewma = scaled;
+	}
+	channel.count++;
+	channel.last = value;
+	if (value < channel.min)
+	{
+		channel.min = value;
+	}
+	if (value > channel.max)
+	{
+		channel.max = value;
+	}
+	channel.ewma += (scaled - channel.ewma) >> HEALTH_EWMA_SHIFT;
+
+	// Welford, numerically stable without a sum of squares
+	float delta = value - channel.mean;
+	channel.mean += delta / channel.count;
+	channel.m2 += delta * (value - channel.mean);
+}
+
+void Tle5012bHealth::learn(uint16_t samples)
+{
+	if (samples == 0)
+	{
+		mag_.baseline = (int32_t) (mag_.mean * (1 << HEALTH_EWMA_FRACTION));
+		temp_.baseline = (int32_t) (temp_.mean * (1 << HEALTH_EWMA_FRACTION));
+		learned_ = (mag_.count != 0);
+		return;
+	}
+	learned_ = false;
+	learn_ = mag_.count + samples;
+}
+
+void Tle5012bHealth::health(Record_t &record) const
+{
+	record.magnitude = (uint16_t) (mag_.ewma >> HEALTH_EWMA_FRACTION);
+	record.magMin = mag_.min;
+	record.magMax = mag_.max;
+	record.magDeviation = (mag_.count > 1) ? (uint16_t) sqrt(mag_.m2 / (mag_.count - 1)) : 0;
+	record.temperature = (uint16_t) (temp_.ewma >> HEALTH_EWMA_FRACTION);
+	record.errorRate = (uint16_t) errorRate_;
+	record.flags = HEALTH_OK;
+	if (learned_)
+	{
+		record.magDrift = toDrift(mag_.ewma - mag_.baseline);
+		record.tempDrift = toDrift(temp_.ewma - temp_.baseline);
+	}else{
+		record.magDrift = 0;
+		record.tempDrift = 0;
+		record.flags |= HEALTH_LEARNING;
+	}
+
+	if (mag_.count != 0)
+	{
+		if ((limits_.magMin != 0) && (record.magnitude < limits_.magMin))
+		{
+			record.flags |= HEALTH_MAG_LOW;
+		}
+		if ((limits_.magMax != 0) && (record.magnitude > limits_.magMax))
+		{
+			record.flags |= HEALTH_MAG_HIGH;
+		}
+	}
+	if ((limits_.magDrift != 0) && (abs(record.magDrift) > limits_.magDrift))
+	{
+		record.flags |= HEALTH_MAG_DRIFT;
+	}
+	if ((limits_.tempDrift != 0) && (abs(record.tempDrift) > limits_.tempDrift))
+	{
+		record.flags |= HEALTH_TEMP_DRIFT;
+	}
+	if ((limits_.errorRate != 0) && (record.errorRate > limits_.errorRate))
+	{
+		record.flags |= HEALTH_ERROR_RATE;
+	}
+}
+
+const Tle5012bHealth::Channel_t &Tle5012bHealth::magnitude() const
+{
+	return (mag_);
+}
+
+const Tle5012bHealth::Channel_t &Tle5012bHealth::temperature() const
+{
+	return (temp_);
+}
+
+const Tle5012bHealth::Stats_t &Tle5012bHealth::getStats() const
+{
+	return (stats_);
+}
+
+void Tle5012bHealth::clear(Channel_t &channel)
+{
+	channel.count = 0;
+	channel.last = 0;
+	channel.min = 0;
+	channel.max = 0;
+	channel.ewma = 0;
+	channel.baseline = 0;
+	channel.mean = 0.0;
+	channel.m2 = 0.0;
+}
+
+void Tle5012bHealth::clearStats()
+{
+	clear(mag_);
+	clear(temp_);
+	errorRate_ = 0;
+	learn_ = HEALTH_LEARN_SAMPLES;
+	learned_ = false;
+	stats_.reads = 0;
+	stats_.errors = 0;
+	stats_.polls = 0;
+	stats_.pollErrors = 0;
+}
@@ -0,0 +1,173 @@
+/*!
+ * \file        tle5012b_health.hpp
+ * \name        tle5012b_health.hpp - magnet and sensor health monitor for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              A weakening or shifting magnet shows up as a slow change of the vector
+ *              magnitude D_MAG long before the angle gets invalid. The monitor is fed with
+ *              the status of each angle read, which only updates an error rate. Every
+ *              interval reads it fetches D_MAG and T_RAW with one two word burst. Each
+ *              channel keeps an EWMA, min/max and a Welford mean and variance in constant
+ *              memory. After a learning phase the mean is frozen as baseline, the drift of
+ *              the EWMA from the baseline and the limits set the flags of the health record.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_HEALTH_HPP
+#define TLE5012B_HEALTH_HPP
+
+#include "TLE5012b.hpp"
+
+#define HEALTH_INTERVAL         64U         //!< \brief default number of recorded reads between two D_MAG/T_RAW reads
+#define HEALTH_LEARN_SAMPLES    16U         //!< \brief default number of D_MAG/T_RAW reads before the baseline is frozen
+#define HEALTH_EWMA_SHIFT       4U          //!< \brief EWMA weight 1/16 of D_MAG and T_RAW
+#define HEALTH_RATE_SHIFT       8U          //!< \brief EWMA weight 1/256 of the error rate
+#define HEALTH_EWMA_FRACTION    8U          //!< \brief fraction bits of the EWMA values
+#define HEALTH_RATE_FULL        0xFFFFU     //!< \brief error rate of errors only
+
+#define HEALTH_OK               0x00U       //!< \brief no limit violated
+#define HEALTH_MAG_LOW          0x01U       //!< \brief magnitude EWMA below the minimum, magnet too weak or too far
+#define HEALTH_MAG_HIGH         0x02U       //!< \brief magnitude EWMA above the maximum, magnet too strong or too close
+#define HEALTH_MAG_DRIFT        0x04U       //!< \brief magnitude EWMA drifted from the baseline
+#define HEALTH_TEMP_DRIFT       0x08U       //!< \brief T_RAW EWMA drifted from the baseline
+#define HEALTH_ERROR_RATE       0x10U       //!< \brief error rate above the limit
+#define HEALTH_LEARNING         0x20U       //!< \brief no baseline yet
+
+/**
+ * @addtogroup tle5012health
+ *
+ * @{
+ */
+
+class Tle5012bHealth
+{
+	public:
+
+		//!< \brief rolling statistics of one register value
+		struct Channel_t
+		{
+			uint32_t count;          //!< \brief number of values
+			uint16_t last;           //!< \brief last value
+			uint16_t min;            //!< \brief smallest value
+			uint16_t max;            //!< \brief largest value
+			int32_t  ewma;           //!< \brief EWMA with HEALTH_EWMA_FRACTION fraction bits
+			int32_t  baseline;       //!< \brief frozen mean with HEALTH_EWMA_FRACTION fraction bits
+			float    mean;           //!< \brief Welford mean
+			float    m2;             //!< \brief Welford sum of squared differences
+		};
+
+		//!< \brief limits of the health flags, 0 switches a limit off
+		struct Limits_t
+		{
+			uint16_t magMin;         //!< \brief minimum magnitude
+			uint16_t magMax;         //!< \brief maximum magnitude
+			uint16_t magDrift;       //!< \brief maximum magnitude drift from the baseline
+			uint16_t tempDrift;      //!< \brief maximum T_RAW drift from the baseline
+			uint16_t errorRate;      //!< \brief maximum error rate, HEALTH_RATE_FULL is 100%
+		};
+
+		//!< \brief compact health record
+		struct Record_t
+		{
+			uint16_t magnitude;      //!< \brief magnitude EWMA
+			uint16_t magMin;         //!< \brief smallest magnitude
+			uint16_t magMax;         //!< \brief largest magnitude
+			uint16_t magDeviation;   //!< \brief standard deviation of the magnitude
+			int16_t  magDrift;       //!< \brief magnitude EWMA minus baseline
+			uint16_t temperature;    //!< \brief T_RAW EWMA
+			int16_t  tempDrift;      //!< \brief T_RAW EWMA minus baseline
+			uint16_t errorRate;      //!< \brief error rate, HEALTH_RATE_FULL is 100%
+			uint8_t  flags;          //!< \brief HEALTH_ flags
+		};
+
+		//!< \brief statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t reads;          //!< \brief recorded angle reads
+			uint32_t errors;         //!< \brief recorded reads with error
+			uint32_t polls;          //!< \brief D_MAG/T_RAW bursts
+			uint32_t pollErrors;     //!< \brief failed D_MAG/T_RAW bursts
+		};
+
+		Tle5012bHealth(Tle5012b &sensor);
+
+		/*!
+		* Sets the number of recorded reads between two D_MAG/T_RAW reads
+		* @param [in] interval recorded reads, 0 reads D_MAG/T_RAW only with poll
+		*/
+		void setInterval(uint16_t interval);
+
+		//!< \brief sets the limits of the health flags
+		void setLimits(const Limits_t &limits);
+
+		/*!
+		* Records the status of an angle read. Every interval reads
+		* D_MAG and T_RAW are read with one burst.
+		* @param [in] status error type of the angle read
+		* @return status of the D_MAG/T_RAW burst if there was one, otherwise NO_ERROR
+		*/
+		errorTypes record(errorTypes status);
+
+		/*!
+		* Reads D_MAG and T_RAW with one burst and adds them
+		* @return CRC error type
+		*/
+		errorTypes poll();
+
+		/*!
+		* Adds D_MAG and T_RAW values which were read elsewhere
+		* @param [in] dmag D_MAG register value
+		* @param [in] traw T_RAW register value
+		*/
+		void add(uint16_t dmag, uint16_t traw);
+
+		/*!
+		* Starts a new learning phase, the baseline is frozen
+		* after the given number of D_MAG/T_RAW values
+		* @param [in] samples number of values, 0 takes the actual EWMA as baseline at once
+		*/
+		void learn(uint16_t samples=HEALTH_LEARN_SAMPLES);
+
+		//!< \brief returns the health record
+		void health(Record_t &record) const;
+
+		//!< \brief returns the statistics of the magnitude channel
+		const Channel_t &magnitude() const;
+
+		//!< \brief returns the statistics of the T_RAW channel
+		const Channel_t &temperature() const;
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics and the channels
+		void clearStats();
+
+	private:
+
+		Tle5012b    &sensor_;        //!< \brief monitored sensor
+		Limits_t    limits_;         //!< \brief limits of the health flags
+		Channel_t   mag_;            //!< \brief D_MAG channel
+		Channel_t   temp_;           //!< \brief T_RAW channel
+		uint32_t    errorRate_;      //!< \brief error rate EWMA with HEALTH_RATE_FULL as 100%
+		uint16_t    interval_;       //!< \brief recorded reads between two polls
+		uint16_t    countdown_;      //!< \brief recorded reads until the next poll
+		uint32_t    learn_;          //!< \brief magnitude count at which the baseline is frozen, same width as Channel_t::count
+		bool        learned_;        //!< \brief baseline is valid
+		Stats_t     stats_;          //!< \brief statistics
+
+		static void update(Channel_t &channel, uint16_t value);
+		static void clear(Channel_t &channel);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_HEALTH_HPP */
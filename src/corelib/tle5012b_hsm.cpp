@@ -0,0 +1,325 @@
+/*!
+ * \file        tle5012b_hsm.cpp
+ * \name        tle5012b_hsm.cpp - hall switch mode decoder for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_hsm.hpp"
+
+/*!
+ * Sector of the hall state with IFA in bit 2, IFB in bit 1 and IFC in bit 0.
+ * The positive direction runs 101 -> 100 -> 110 -> 010 -> 011 -> 001.
+ */
+static const uint8_t sectorTable[8] = {
+	HSM_INVALID_SECTOR, 5, 3, 4, 1, 0, 2, HSM_INVALID_SECTOR
+};
+
+//!< \brief electrical angle at the start of each sector, the last entry closes sector 5
+static const uint32_t sectorStart[HSM_SECTORS + 1] = {
+	0, 10923, 21845, 32768, 43691, 54613, HSM_ELECTRICAL_FULL
+};
+
+HSMDecoder::HSMDecoder():
+	sequence_(0),
+	state_(0),
+	tickRate_(1000000UL),
+	polePairs_(1),
+	invert_(false)
+{
+	configure(1);
+	clearStats();
+}
+
+void HSMDecoder::configure(uint8_t polePairs, bool invert)
+{
+	Snapshot_t snap;
+	polePairs_ = (polePairs == 0) ? 1 : polePairs;
+	invert_ = invert;
+	snap.sector = sectorTable[state_];
+	snap.direction = 0;
+	snap.position = 0;
+	snap.lastEdge = 0;
+	snap.period = 0;
+	publish(snap);
+}
+
+void HSMDecoder::setTickRate(uint32_t rate)
+{
+	tickRate_ = rate;
+}
+
+void HSMDecoder::setLevels(bool levelA, bool levelB, bool levelC)
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	state_ = (levelA ? 0x04 : 0x00) | (levelB ? 0x02 : 0x00) | (levelC ? 0x01 : 0x00);
+	snap.sector = sectorTable[state_];
+	snap.period = 0;
+	publish(snap);
+}
+
+void HSMDecoder::snapshot(Snapshot_t &snap) const
+{
+	uint16_t sequence;
+	do
+	{
+		// an edge during the copy rewrites the buffer, so copy again
+		sequence = sequence_;
+		const volatile Snapshot_t &shot = shot_[sequence & 0x01];
+		snap.sector = shot.sector;
+		snap.direction = shot.direction;
+		snap.position = shot.position;
+		snap.lastEdge = shot.lastEdge;
+		snap.period = shot.period;
+	} while (sequence != sequence_);
+}
+
+void HSMDecoder::publish(const Snapshot_t &snap)
+{
+	// write the unused buffer, a reader interrupting us still sees the old one
+	uint16_t next = sequence_ + 1;
+	volatile Snapshot_t &shot = shot_[next & 0x01];
+	shot.sector = snap.sector;
+	shot.direction = snap.direction;
+	shot.position = snap.position;
+	shot.lastEdge = snap.lastEdge;
+	shot.period = snap.period;
+	sequence_ = next;
+}
+
+void HSMDecoder::edge(uint8_t channel, bool level, uint32_t timestamp)
+{
+	if (channel > 2)
+	{
+		return;
+	}
+	uint8_t bit = 0x04 >> channel;
+	uint8_t state = level ? (state_ | bit) : (state_ & ~bit);
+
+	stats_.edges++;
+	if (state == state_)
+	{
+		// the opposite edge of this channel was missed
+		stats_.missed++;
+		return;
+	}
+	state_ = state;
+
+	Snapshot_t snap;
+	snapshot(snap);
+	uint8_t sector = sectorTable[state];
+	if (sector == HSM_INVALID_SECTOR)
+	{
+		stats_.invalid++;
+		snap.period = 0;
+	}else if (snap.sector != HSM_INVALID_SECTOR)
+	{
+		// sector step in -2 .. 3, 3 is half an electrical revolution and has no direction
+		int8_t diff = (int8_t) sector - (int8_t) snap.sector;
+		if (diff > 3)
+		{
+			diff -= HSM_SECTORS;
+		}else if (diff <= -3)
+		{
+			diff += HSM_SECTORS;
+		}
+		if ((diff == 1) || (diff == -1))
+		{
+			// the period is only valid between two edges of the same direction
+			snap.period = (diff == snap.direction) ? (timestamp - snap.lastEdge) : 0;
+			snap.direction = diff;
+		}else{
+			stats_.skipped++;
+			snap.period = 0;
+		}
+		snap.position += diff;
+	}else{
+		snap.period = 0;
+	}
+	snap.sector = sector;
+	snap.lastEdge = timestamp;
+	publish(snap);
+}
+
+uint8_t HSMDecoder::sector() const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	return (snap.sector);
+}
+
+uint32_t HSMDecoder::lastEdge() const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	return (snap.lastEdge);
+}
+
+uint32_t HSMDecoder::sectorPeriod() const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	return (snap.period);
+}
+
+uint16_t HSMDecoder::electricalAngle(uint32_t now) const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	if (snap.sector == HSM_INVALID_SECTOR)
+	{
+		return (0);
+	}
+	uint32_t start = sectorStart[snap.sector];
+	uint32_t width = sectorStart[snap.sector + 1] - start;
+	if ((snap.period == 0) || (snap.direction == 0))
+	{
+		return ((uint16_t) (start + width / 2));
+	}
+
+	uint32_t elapsed = now - snap.lastEdge;
+	uint32_t offset = width - 1;
+	if (elapsed < snap.period)
+	{
+		// scale to 16 bit so the fraction fits into 32 bit
+		uint32_t period = snap.period;
+		while (period > 0xFFFFU)
+		{
+			period >>= 1;
+			elapsed >>= 1;
+		}
+		uint32_t fraction = (elapsed << 16) / period;
+		offset = (fraction * width) >> 16;
+	}
+	if (snap.direction > 0)
+	{
+		return ((uint16_t) (start + offset));
+	}
+	return ((uint16_t) (start + width - offset));
+}
+
+int32_t HSMDecoder::position() const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	return (invert_ ? -snap.position : snap.position);
+}
+
+uint16_t HSMDecoder::sectorsPerRevolution() const
+{
+	return ((uint16_t) (HSM_SECTORS * polePairs_));
+}
+
+int16_t HSMDecoder::rawAngle() const
+{
+	int32_t spr = sectorsPerRevolution();
+	int32_t pos = position() % spr;
+	if (pos < 0)
+	{
+		pos += spr;
+	}
+	int32_t raw = (pos * (int32_t) POW_2_15) / spr;
+	if (raw & CHECK_BIT_14)
+	{
+		raw -= CHANGE_UINT_TO_INT_15;
+	}
+	return ((int16_t) raw);
+}
+
+int32_t HSMDecoder::sectorRate(uint32_t now) const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	uint32_t period = snap.period;
+	uint32_t since = now - snap.lastEdge;
+	if ((period == 0) || (since >= tickRate_))
+	{
+		return (0);
+	}
+	if (since > period)
+	{
+		period = since;
+	}
+	int32_t rate = snap.direction * (int32_t) (((uint64_t) tickRate_ + (period / 2)) / period);
+	return (invert_ ? -rate : rate);
+}
+
+double HSMDecoder::angleSpeed(uint32_t now) const
+{
+	return (sectorRate(now) * (ANGLE_360_VAL / sectorsPerRevolution()));
+}
+
+const HSMDecoder::Stats_t &HSMDecoder::getStats() const
+{
+	return (stats_);
+}
+
+void HSMDecoder::clearStats()
+{
+	stats_.edges = 0;
+	stats_.invalid = 0;
+	stats_.missed = 0;
+	stats_.skipped = 0;
+}
+
+
+Tle5012bHSM::Tle5012bHSM(Tle5012b &sensor, Capture &capture):
+	sensor_(sensor),
+	capture_(capture)
+{
+}
+
+Tle5012bHSM::~Tle5012bHSM()
+{
+	end();
+}
+
+void Tle5012bHSM::onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg)
+{
+	((Tle5012bHSM *) arg)->decoder_.edge(channel, level, timestamp);
+}
+
+errorTypes Tle5012bHSM::begin(bool invert)
+{
+	uint16_t mod4 = 0;
+	errorTypes status = sensor_.readIntMode4(mod4);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	if (Reg::REG_MOD_4_IFMD::extract(mod4) != Reg::HSM)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+
+	decoder_.configure((uint8_t) (Reg::REG_MOD_4_HSMPLP::extract(mod4) + 1), invert);
+	decoder_.setTickRate(capture_.tickRate());
+	decoder_.setLevels(capture_.level(0), capture_.level(1), capture_.level(2));
+	if (capture_.init(onEdge, this) != Capture::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	return (NO_ERROR);
+}
+
+void Tle5012bHSM::end()
+{
+	capture_.deinit();
+}
+
+uint16_t Tle5012bHSM::electricalAngle()
+{
+	return (decoder_.electricalAngle(capture_.now()));
+}
+
+HSMDecoder &Tle5012bHSM::decoder()
+{
+	return (decoder_);
+}
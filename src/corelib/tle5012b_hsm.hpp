@@ -0,0 +1,193 @@
+/*!
+ * \file        tle5012b_hsm.hpp
+ * \name        tle5012b_hsm.hpp - hall switch mode decoder for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              In HSM mode the sensor emulates the three hall switches of a BLDC motor on
+ *              IFA, IFB and IFC, with the number of pole pairs set with HSMPLP. The
+ *              HSMDecoder turns the hall edges into the commutation sector and interpolates
+ *              the electrical angle between two edges with the last sector period. It uses
+ *              integer math only and the edge handler is short enough for interrupt context.
+ *              Tle5012bHSM connects the decoder with a capture PAL.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_HSM_HPP
+#define TLE5012B_HSM_HPP
+
+#include "../pal/capture.hpp"
+#include "TLE5012b.hpp"
+
+#define HSM_SECTORS             6U          //!< \brief commutation sectors per electrical revolution
+#define HSM_INVALID_SECTOR      0xFFU       //!< \brief hall state 000 or 111
+#define HSM_ELECTRICAL_FULL     0x10000UL   //!< \brief electrical angle of one electrical revolution
+
+/**
+ * @addtogroup tle5012hsm
+ *
+ * @{
+ */
+
+class HSMDecoder
+{
+	public:
+
+		//!< \brief decoder statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t edges;          //!< \brief number of edges fed into the decoder
+			uint32_t invalid;        //!< \brief edges to the hall states 000 or 111
+			uint32_t missed;         //!< \brief edges without level change, the edge before was missed
+			uint32_t skipped;        //!< \brief sector changes by more than one sector
+		};
+
+		HSMDecoder();
+
+		/*!
+		* Sets the pole pairs, resets the position to zero
+		* @param [in] polePairs pole pairs of the motor, 1 to 16, HSMPLP + 1
+		* @param [in] invert true counts down for the positive direction of the sensor
+		*/
+		void configure(uint8_t polePairs, bool invert=false);
+
+		/*!
+		* Sets the time base of the edge timestamps
+		* @param [in] rate timestamp ticks per second
+		*/
+		void setTickRate(uint32_t rate);
+
+		/*!
+		* Sets the hall levels without counting, e.g. after the capture was started
+		* @param [in] levelA actual IFA level
+		* @param [in] levelB actual IFB level
+		* @param [in] levelC actual IFC level
+		*/
+		void setLevels(bool levelA, bool levelB, bool levelC);
+
+		/*!
+		* Feeds one edge into the decoder, can be called from interrupt context
+		* @param [in] channel 0 = IFA, 1 = IFB, 2 = IFC
+		* @param [in] level level after the edge
+		* @param [in] timestamp edge time in ticks
+		*/
+		void edge(uint8_t channel, bool level, uint32_t timestamp);
+
+		//!< \brief actual sector 0 to 5, sector 0 starts with the rising edge of IFA, HSM_INVALID_SECTOR for 000 or 111
+		uint8_t sector() const;
+
+		//!< \brief timestamp of the last sector change
+		uint32_t lastEdge() const;
+
+		//!< \brief ticks of the last sector, 0 if unknown or after a direction change
+		uint32_t sectorPeriod() const;
+
+		/*!
+		* Electrical angle interpolated with the last sector period. The
+		* interpolation stops at the sector border until the next edge. Without
+		* a valid period the angle is the middle of the sector.
+		* @param [in] now actual time in ticks
+		* @return electrical angle, HSM_ELECTRICAL_FULL is 360°
+		*/
+		uint16_t electricalAngle(uint32_t now) const;
+
+		//!< \brief sector changes since configure, multi turn
+		int32_t position() const;
+
+		//!< \brief sector changes per mechanical revolution
+		uint16_t sectorsPerRevolution() const;
+
+		//!< \brief mechanical position as signed 15 bit raw angle relative to configure, same unit than AVAL
+		int16_t rawAngle() const;
+
+		/*!
+		* Sector rate from the last sector period. Without new edges the
+		* rate decays with the time since the last edge and is zero after one second.
+		* @param [in] now actual time in ticks
+		* @return sectors per second, negative for the negative direction
+		*/
+		int32_t sectorRate(uint32_t now) const;
+
+		/*!
+		* Mechanical angle speed from sectorRate
+		* @param [in] now actual time in ticks
+		* @return angle speed in degrees per second
+		*/
+		double angleSpeed(uint32_t now) const;
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics
+		void clearStats();
+
+	private:
+
+		//!< \brief values written by edge, double buffered for readers in any context
+		struct Snapshot_t
+		{
+			uint8_t  sector;         //!< \brief actual sector
+			int8_t   direction;      //!< \brief sensor direction of the last sector change
+			int32_t  position;       //!< \brief sector changes since configure in sensor direction
+			uint32_t lastEdge;       //!< \brief timestamp of the last sector change
+			uint32_t period;         //!< \brief ticks between the last two sector changes, 0 unknown
+		};
+
+		volatile Snapshot_t shot_[2];    //!< \brief the valid snapshot is selected by the lowest sequence bit
+		volatile uint16_t sequence_;     //!< \brief incremented by edge after each completed update
+		uint8_t           state_;        //!< \brief IFA level in bit 2, IFB in bit 1, IFC in bit 0
+		uint32_t          tickRate_;     //!< \brief timestamp ticks per second
+		uint8_t           polePairs_;    //!< \brief pole pairs of the motor
+		bool              invert_;       //!< \brief inverted counting direction
+		Stats_t           stats_;        //!< \brief decoder statistics
+
+		void snapshot(Snapshot_t &snap) const;
+		void publish(const Snapshot_t &snap);
+};
+
+class Tle5012bHSM
+{
+	public:
+
+		Tle5012bHSM(Tle5012b &sensor, Capture &capture);
+		~Tle5012bHSM();
+
+		/*!
+		* Reads IFMD and HSMPLP from the sensor and starts the capture of the
+		* three hall outputs. The sensor must already be in HSM mode, see writeInterfaceType.
+		* @param [in] invert true counts down for the positive direction of the sensor
+		* @return CRC error type, INTERFACE_ACCESS_ERROR if HSM is off or the capture fails
+		*/
+		errorTypes begin(bool invert=false);
+
+		//!< \brief stops the capture
+		void end();
+
+		/*!
+		* Electrical angle at the actual capture time
+		* @return electrical angle, HSM_ELECTRICAL_FULL is 360°
+		*/
+		uint16_t electricalAngle();
+
+		//!< \brief the decoder with sector, position and speed
+		HSMDecoder &decoder();
+
+	private:
+
+		Tle5012b    &sensor_;        //!< \brief sensor in HSM mode
+		Capture     &capture_;       //!< \brief edge capture of IFA, IFB and IFC
+		HSMDecoder  decoder_;        //!< \brief hall decoder
+
+		static void onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_HSM_HPP */
@@ -0,0 +1,357 @@
+/*!
+ * \file        tle5012b_iif.cpp
+ * \name        tle5012b_iif.cpp - incremental interface decoder for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_iif.hpp"
+
+/*!
+ * A/B transition table with the state as IFA level in bit 1 and IFB level
+ * in bit 0, indexed by old state * 4 + new state. IFA leading IFB
+ * (00 -> 10 -> 11 -> 01) counts up. One edge changes only one level,
+ * so double changes do not occur.
+ */
+static const int8_t quadratureTable[16] = {
+	 0, -1,  1,  0,
+	 1,  0,  0, -1,
+	-1,  0,  0,  1,
+	 0,  1, -1,  0
+};
+
+IIFDecoder::IIFDecoder():
+	sequence_(0),
+	offsetSequence_(0),
+	state_(0),
+	tickRate_(1000000UL),
+	mode_(IIF_AB),
+	shift_(3),
+	invert_(false)
+{
+	configure(IIF_AB, 0);
+	clearStats();
+}
+
+void IIFDecoder::configure(mode_t mode, uint8_t ifabres, bool invert)
+{
+	Snapshot_t snap;
+	mode_ = mode;
+	// 12 bit increments at IFABRES 0, one bit less per step, AVAL has 15 bit
+	shift_ = 3 + (ifabres & 0x03);
+	invert_ = invert;
+	snap.count = 0;
+	snap.lastEdge = 0;
+	snap.period = 0;
+	snap.direction = 0;
+	publish(snap);
+	setOffset(0);
+}
+
+void IIFDecoder::setTickRate(uint32_t rate)
+{
+	tickRate_ = rate;
+}
+
+void IIFDecoder::setLevels(bool levelA, bool levelB)
+{
+	state_ = (levelA ? 0x02 : 0x00) | (levelB ? 0x01 : 0x00);
+}
+
+void IIFDecoder::snapshot(Snapshot_t &snap) const
+{
+	uint16_t sequence;
+	do
+	{
+		// an edge during the copy rewrites the buffer, so copy again
+		sequence = sequence_;
+		const volatile Snapshot_t &shot = shot_[sequence & 0x01];
+		snap.count = shot.count;
+		snap.lastEdge = shot.lastEdge;
+		snap.period = shot.period;
+		snap.direction = shot.direction;
+	} while (sequence != sequence_);
+}
+
+void IIFDecoder::publish(const Snapshot_t &snap)
+{
+	// write the unused buffer, a reader interrupting us still sees the old one
+	uint16_t next = sequence_ + 1;
+	volatile Snapshot_t &shot = shot_[next & 0x01];
+	shot.count = snap.count;
+	shot.lastEdge = snap.lastEdge;
+	shot.period = snap.period;
+	shot.direction = snap.direction;
+	sequence_ = next;
+}
+
+int32_t IIFDecoder::offset() const
+{
+	uint16_t sequence;
+	int32_t offset;
+	do
+	{
+		sequence = offsetSequence_;
+		offset = offset_[sequence & 0x01];
+	} while (sequence != offsetSequence_);
+	return (offset);
+}
+
+void IIFDecoder::setOffset(int32_t offset)
+{
+	uint16_t next = offsetSequence_ + 1;
+	offset_[next & 0x01] = offset;
+	offsetSequence_ = next;
+}
+
+void IIFDecoder::step(int8_t dir, uint32_t timestamp)
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	if (invert_)
+	{
+		dir = -dir;
+	}
+	// the period is only valid between two edges of the same direction
+	snap.period = (dir == snap.direction) ? (timestamp - snap.lastEdge) : 0;
+	snap.lastEdge = timestamp;
+	snap.direction = dir;
+	snap.count += dir;
+	publish(snap);
+}
+
+void IIFDecoder::edge(uint8_t channel, bool level, uint32_t timestamp)
+{
+	uint8_t bit = (channel == 0) ? 0x02 : 0x01;
+	uint8_t state = level ? (state_ | bit) : (state_ & ~bit);
+
+	stats_.edges++;
+	if (state == state_)
+	{
+		// the opposite edge of this channel was missed
+		stats_.invalid++;
+		return;
+	}
+	if (mode_ == IIF_STEP_DIR)
+	{
+		// count rising step edges, IFB low counts up
+		if ((channel == 0) && level && !(state_ & 0x02))
+		{
+			step((state & 0x01) ? -1 : 1, timestamp);
+		}
+		state_ = state;
+		return;
+	}
+
+	step(quadratureTable[(state_ << 2) | state], timestamp);
+	state_ = state;
+}
+
+int32_t IIFDecoder::count() const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	return (snap.count + offset());
+}
+
+uint16_t IIFDecoder::countsPerRevolution() const
+{
+	return ((uint16_t) (0x8000U >> shift_));
+}
+
+int16_t IIFDecoder::rawAngle() const
+{
+	int32_t cpr = countsPerRevolution();
+	int32_t pos = count() % cpr;
+	if (pos < 0)
+	{
+		pos += cpr;
+	}
+	int32_t raw = pos << shift_;
+	if (raw & CHECK_BIT_14)
+	{
+		raw -= CHANGE_UINT_TO_INT_15;
+	}
+	return ((int16_t) raw);
+}
+
+double IIFDecoder::angleValue() const
+{
+	return ((ANGLE_360_VAL / POW_2_15) * ((double) rawAngle()));
+}
+
+int32_t IIFDecoder::countRate(uint32_t now) const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	uint32_t period = snap.period;
+	uint32_t since = now - snap.lastEdge;
+	if ((period == 0) || (since >= tickRate_))
+	{
+		return (0);
+	}
+	if (since > period)
+	{
+		period = since;
+	}
+	return (snap.direction * (int32_t) (((uint64_t) tickRate_ + (period / 2)) / period));
+}
+
+double IIFDecoder::angleSpeed(uint32_t now) const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	uint32_t period = snap.period;
+	uint32_t since = now - snap.lastEdge;
+	if ((period == 0) || (since >= tickRate_))
+	{
+		return (0.0);
+	}
+	if (since > period)
+	{
+		period = since;
+	}
+	return (snap.direction * ((double) tickRate_ / (double) period) * (ANGLE_360_VAL / countsPerRevolution()));
+}
+
+int16_t IIFDecoder::synchronize(int16_t rawAngle)
+{
+	int32_t cpr = countsPerRevolution();
+	int32_t target = ((uint16_t) rawAngle & DELETE_BIT_15) >> shift_;
+	int32_t pos = count() % cpr;
+	if (pos < 0)
+	{
+		pos += cpr;
+	}
+	// shortest way around the revolution
+	int32_t drift = target - pos;
+	if (drift >= cpr / 2)
+	{
+		drift -= cpr;
+	}else if (drift < -(cpr / 2))
+	{
+		drift += cpr;
+	}
+	setOffset(offset() + drift);
+
+	uint16_t absDrift = (uint16_t) ((drift < 0) ? -drift : drift);
+	stats_.resyncs++;
+	stats_.lastDrift = (int16_t) drift;
+	if (absDrift > stats_.maxDrift)
+	{
+		stats_.maxDrift = absDrift;
+	}
+	return ((int16_t) drift);
+}
+
+const IIFDecoder::Stats_t &IIFDecoder::getStats() const
+{
+	return (stats_);
+}
+
+void IIFDecoder::clearStats()
+{
+	stats_.edges = 0;
+	stats_.invalid = 0;
+	stats_.resyncs = 0;
+	stats_.lastDrift = 0;
+	stats_.maxDrift = 0;
+}
+
+
+Tle5012bIIF::Tle5012bIIF(Tle5012b &sensor, Capture &capture):
+	sensor_(sensor),
+	capture_(capture),
+	syncPeriod_(0),
+	lastSync_(0)
+{
+}
+
+Tle5012bIIF::~Tle5012bIIF()
+{
+	end();
+}
+
+void Tle5012bIIF::onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg)
+{
+	((Tle5012bIIF *) arg)->decoder_.edge(channel, level, timestamp);
+}
+
+errorTypes Tle5012bIIF::begin(bool invert)
+{
+	uint16_t mod1 = 0;
+	uint16_t mod4 = 0;
+	errorTypes status = sensor_.readIntMode1(mod1);
+	if (status == NO_ERROR)
+	{
+		status = sensor_.readIntMode4(mod4);
+	}
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	uint16_t iifmod = Reg::REG_MOD_1_IIFMOD::extract(mod1);
+	if ((iifmod != IIFDecoder::IIF_AB) && (iifmod != IIFDecoder::IIF_STEP_DIR))
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+
+	decoder_.configure((IIFDecoder::mode_t) iifmod, (uint8_t) Reg::REG_MOD_4_IFABRES::extract(mod4), invert);
+	decoder_.setTickRate(capture_.tickRate());
+	if (capture_.init(onEdge, this) != Capture::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	// levels after the start of the capture, so no edge falls between the read and
+	// the first interrupt, the count of an edge before setLevels is corrected by synchronize
+	decoder_.setLevels(capture_.level(0), capture_.level(1));
+	return (synchronize());
+}
+
+void Tle5012bIIF::end()
+{
+	capture_.deinit();
+}
+
+void Tle5012bIIF::setSyncPeriod(uint32_t period)
+{
+	syncPeriod_ = (uint32_t) (((uint64_t) period * capture_.tickRate()) / 1000);
+}
+
+errorTypes Tle5012bIIF::synchronize()
+{
+	uint16_t rawData = 0;
+	errorTypes status = sensor_.readFromSensor(sensor_.reg.REG_AVAL, rawData, UPD_low, SAFE_high);
+	lastSync_ = capture_.now();
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	rawData = (rawData & (DELETE_BIT_15));
+	if (rawData & CHECK_BIT_14)
+	{
+		rawData = rawData - CHANGE_UINT_TO_INT_15;
+	}
+	decoder_.synchronize((int16_t) rawData);
+	return (status);
+}
+
+errorTypes Tle5012bIIF::update()
+{
+	if ((syncPeriod_ == 0) || ((capture_.now() - lastSync_) < syncPeriod_))
+	{
+		return (NO_ERROR);
+	}
+	return (synchronize());
+}
+
+IIFDecoder &Tle5012bIIF::decoder()
+{
+	return (decoder_);
+}
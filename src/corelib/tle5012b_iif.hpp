@@ -0,0 +1,213 @@
+/*!
+ * \file        tle5012b_iif.hpp
+ * \name        tle5012b_iif.hpp - incremental interface decoder for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              In IIF mode the sensor emits the angle as A/B quadrature or step/direction
+ *              pulses on IFA and IFB. The IIFDecoder counts timestamped edges, which makes
+ *              the position available at pulse rate without any SPI transfer. It has no
+ *              hardware dependency and can be fed with synthetic edges. Tle5012bIIF connects
+ *              the decoder with a capture PAL and corrects the count with the absolute AVAL
+ *              angle read over SSC, so missed or glitched edges do not drift for long.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_IIF_HPP
+#define TLE5012B_IIF_HPP
+
+#include "../pal/capture.hpp"
+#include "TLE5012b.hpp"
+
+/**
+ * @addtogroup tle5012iif
+ *
+ * @{
+ */
+
+class IIFDecoder
+{
+	public:
+
+		//!< \brief pulse mode, same values than IIFMOD of MOD_1
+		enum mode_t
+		{
+			IIF_AB       = 1,    //!< \brief A/B quadrature with 90° phase shift, every edge is one increment
+			IIF_STEP_DIR = 2     //!< \brief IFA step pulses, IFB direction
+		};
+
+		//!< \brief decoder statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t edges;          //!< \brief number of edges fed into the decoder
+			uint32_t invalid;        //!< \brief edges without level change, the edge before was missed
+			uint32_t resyncs;        //!< \brief number of synchronize calls
+			int16_t  lastDrift;      //!< \brief last correction in increments
+			uint16_t maxDrift;       //!< \brief largest absolute correction in increments
+		};
+
+		IIFDecoder();
+
+		/*!
+		* Sets the pulse mode and resolution, resets the count to zero
+		* @param [in] mode pulse mode of IIFMOD
+		* @param [in] ifabres IFABRES value of MOD_4, 0 = 12 bit ... 3 = 9 bit increments per revolution
+		* @param [in] invert true counts down for the positive direction of the sensor
+		*/
+		void configure(mode_t mode, uint8_t ifabres, bool invert=false);
+
+		/*!
+		* Sets the time base of the edge timestamps
+		* @param [in] rate timestamp ticks per second
+		*/
+		void setTickRate(uint32_t rate);
+
+		/*!
+		* Sets the input levels without counting, e.g. after the capture was started
+		* @param [in] levelA actual IFA level
+		* @param [in] levelB actual IFB level
+		*/
+		void setLevels(bool levelA, bool levelB);
+
+		/*!
+		* Feeds one edge into the decoder, can be called from interrupt context
+		* @param [in] channel 0 = IFA, 1 = IFB
+		* @param [in] level level after the edge
+		* @param [in] timestamp edge time in ticks
+		*/
+		void edge(uint8_t channel, bool level, uint32_t timestamp);
+
+		//!< \brief increments since configure including all corrections, multi turn
+		int32_t count() const;
+
+		//!< \brief increments per revolution of the set resolution
+		uint16_t countsPerRevolution() const;
+
+		//!< \brief position as signed 15 bit raw angle, same unit than AVAL
+		int16_t rawAngle() const;
+
+		//!< \brief position in degrees -180 to 180, same range than getAngleValue
+		double angleValue() const;
+
+		/*!
+		* Increment rate from the time between the last two edges. Without
+		* new edges the rate decays with the time since the last edge and
+		* is zero after one second.
+		* @param [in] now actual time in ticks
+		* @return increments per second, negative for the negative direction
+		*/
+		int32_t countRate(uint32_t now) const;
+
+		/*!
+		* Angle speed from countRate
+		* @param [in] now actual time in ticks
+		* @return angle speed in degrees per second
+		*/
+		double angleSpeed(uint32_t now) const;
+
+		/*!
+		* Corrects the position to an absolute angle. The correction is
+		* kept apart from the edge count, so edges from interrupt context
+		* do not race with it. Call it from one context only, readers of
+		* the position may run in any context.
+		* @param [in] rawAngle signed 15 bit raw angle value of AVAL
+		* @return applied correction in increments
+		*/
+		int16_t synchronize(int16_t rawAngle);
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics
+		void clearStats();
+
+	private:
+
+		//!< \brief values written by edge, double buffered for readers in any context
+		struct Snapshot_t
+		{
+			int32_t  count;          //!< \brief edge count
+			uint32_t lastEdge;       //!< \brief timestamp of the last counted edge
+			uint32_t period;         //!< \brief ticks between the last two counted edges, 0 unknown
+			int8_t   direction;      //!< \brief direction of the last counted edge
+		};
+
+		volatile Snapshot_t shot_[2];      //!< \brief the valid snapshot is selected by the lowest sequence bit
+		volatile uint16_t sequence_;       //!< \brief incremented by edge after each completed update
+		volatile int32_t  offset_[2];      //!< \brief corrections, written by synchronize only, double buffered as the snapshot
+		volatile uint16_t offsetSequence_; //!< \brief incremented by synchronize after each correction
+		volatile uint8_t  state_;          //!< \brief IFA level in bit 1, IFB level in bit 0
+		uint32_t          tickRate_;       //!< \brief timestamp ticks per second
+		mode_t            mode_;           //!< \brief pulse mode
+		uint8_t           shift_;          //!< \brief bits between AVAL and the increment resolution
+		bool              invert_;         //!< \brief inverted counting direction
+		Stats_t           stats_;          //!< \brief decoder statistics
+
+		void step(int8_t dir, uint32_t timestamp);
+		void snapshot(Snapshot_t &snap) const;
+		void publish(const Snapshot_t &snap);
+		int32_t offset() const;
+		void setOffset(int32_t offset);
+};
+
+class Tle5012bIIF
+{
+	public:
+
+		Tle5012bIIF(Tle5012b &sensor, Capture &capture);
+		~Tle5012bIIF();
+
+		/*!
+		* Reads IIFMOD and IFABRES from the sensor, starts the capture and
+		* synchronizes the decoder with the first AVAL read. The sensor must
+		* already be in IIF mode, see writeInterfaceType.
+		* @param [in] invert true counts down for the positive direction of the sensor
+		* @return CRC error type, INTERFACE_ACCESS_ERROR if IIF is off or the capture fails
+		*/
+		errorTypes begin(bool invert=false);
+
+		//!< \brief stops the capture
+		void end();
+
+		/*!
+		* Sets the period of the AVAL synchronization done by update
+		* @param [in] period time in milliseconds, 0 switches the synchronization off
+		*/
+		void setSyncPeriod(uint32_t period);
+
+		/*!
+		* Reads AVAL over SSC and corrects the decoder position
+		* @return CRC error type, the decoder is unchanged on error
+		*/
+		errorTypes synchronize();
+
+		/*!
+		* Synchronizes if the sync period has passed, call it from the main loop
+		* @return CRC error type of the synchronization
+		*/
+		errorTypes update();
+
+		//!< \brief the decoder with position and speed
+		IIFDecoder &decoder();
+
+	private:
+
+		Tle5012b    &sensor_;        //!< \brief sensor in IIF mode
+		Capture     &capture_;       //!< \brief edge capture of IFA and IFB
+		IIFDecoder  decoder_;        //!< \brief quadrature decoder
+		uint32_t    syncPeriod_;     //!< \brief synchronization period in capture ticks
+		uint32_t    lastSync_;       //!< \brief capture time of the last synchronization
+
+		static void onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_IIF_HPP */
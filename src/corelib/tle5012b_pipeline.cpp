@@ -0,0 +1,139 @@
+/*!
+ * \file        tle5012b_pipeline.cpp
+ * \name        tle5012b_pipeline.cpp - pipelined register reads for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_pipeline.hpp"
+
+Tle5012bPipeline::Tle5012bPipeline(Tle5012b &sensor):
+	sensor_(sensor),
+	command_(0),
+	length_(0),
+	safe_(SAFE_high),
+	active_(0),
+	running_(false)
+{
+	clearStats();
+}
+
+Tle5012bPipeline::~Tle5012bPipeline()
+{
+	stop();
+}
+
+errorTypes Tle5012bPipeline::issue()
+{
+	SPIC::Error_t err = sensor_.sBus->startTransfer(&command_, 1, buffer_[active_], length_ + safe_);
+	running_ = (err == SPIC::OK);
+	if (!running_)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	return (NO_ERROR);
+}
+
+errorTypes Tle5012bPipeline::start(uint16_t command, updTypes upd, safetyTypes safe)
+{
+	stop();
+	command_ = READ_SENSOR | command | upd;
+	// with ND = 0 the sensor sends no safety word, so a single register is read with ND = 1
+	length_ = command_ & 0x000F;
+	if (length_ == 0)
+	{
+		length_ = 1;
+		command_ |= length_;
+	}
+	safe_ = safe;
+	active_ = 0;
+	return (issue());
+}
+
+errorTypes Tle5012bPipeline::read(uint16_t data[])
+{
+	if (!running_)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+
+	// a frame still on the wire after the last decode means the wire is the limit
+	if (sensor_.sBus->isTransferBusy())
+	{
+		stats_.wireBound++;
+	}else{
+		stats_.cpuBound++;
+	}
+	uint8_t done = active_;
+	errorTypes status = (sensor_.sBus->waitTransfer() == SPIC::OK) ? NO_ERROR : INTERFACE_ACCESS_ERROR;
+
+	// next frame first, then the decode of the finished one
+	active_ ^= 1;
+	errorTypes next = issue();
+	if ((next == NO_ERROR) && sensor_.sBus->isTransferBusy())
+	{
+		stats_.overlapped++;
+	}
+
+	stats_.frames++;
+	memcpy(data, buffer_[done], length_ * sizeof(uint16_t));
+	if ((status == NO_ERROR) && (safe_ == SAFE_high))
+	{
+		status = sensor_.verifySafety(buffer_[done][length_], command_, buffer_[done], length_);
+	}
+	if (status != NO_ERROR)
+	{
+		stats_.errors++;
+		memset(data, 0, length_ * sizeof(uint16_t));
+		if ((status == SYSTEM_ERROR) || (status == CRC_ERROR))
+		{
+			// resetSafety needs the bus, the frame in flight is dropped
+			if (running_)
+			{
+				sensor_.sBus->waitTransfer();
+			}
+			sensor_.resetSafety();
+			next = issue();
+		}
+	}
+	return ((status != NO_ERROR) ? status : next);
+}
+
+errorTypes Tle5012bPipeline::stop()
+{
+	errorTypes status = NO_ERROR;
+	if (running_)
+	{
+		running_ = false;
+		if (sensor_.sBus->waitTransfer() != SPIC::OK)
+		{
+			status = INTERFACE_ACCESS_ERROR;
+		}
+	}
+	return (status);
+}
+
+bool Tle5012bPipeline::isRunning() const
+{
+	return (running_);
+}
+
+const Tle5012bPipeline::Stats_t &Tle5012bPipeline::getStats() const
+{
+	return (stats_);
+}
+
+void Tle5012bPipeline::clearStats()
+{
+	stats_.frames = 0;
+	stats_.overlapped = 0;
+	stats_.wireBound = 0;
+	stats_.cpuBound = 0;
+	stats_.errors = 0;
+}
@@ -0,0 +1,103 @@
+/*!
+ * \file        tle5012b_pipeline.hpp
+ * \name        tle5012b_pipeline.hpp - pipelined register reads for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The pipeline repeats one read command with two response buffers.
+ *              Each read waits for the frame on the wire, starts the next frame into
+ *              the other buffer and only then checks the CRC and copies the finished
+ *              frame, so the decode overlaps with the next transfer. The overlap needs
+ *              a SPIC with an asynchronous startTransfer, with the blocking default
+ *              the pipeline works, but the statistics show no overlap.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_PIPELINE_HPP
+#define TLE5012B_PIPELINE_HPP
+
+#include "TLE5012b.hpp"
+
+#define PIPELINE_FRAME_WORDS    0x10    //!< \brief response buffer, 15 registers and the safety word
+
+/**
+ * @addtogroup tle5012pipeline
+ *
+ * @{
+ */
+
+class Tle5012bPipeline
+{
+	public:
+
+		//!< \brief instrumentation of the pipeline since the last clearStats
+		struct Stats_t
+		{
+			uint32_t frames;       //!< \brief number of frames returned by read
+			uint32_t overlapped;   //!< \brief frames still on the wire when the decode of the previous frame started
+			uint32_t wireBound;    //!< \brief reads which had to wait for the wire after the decode
+			uint32_t cpuBound;     //!< \brief reads which found the frame already complete
+			uint32_t errors;       //!< \brief frames with an interface, safety or CRC error
+		};
+
+		Tle5012bPipeline(Tle5012b &sensor);
+		~Tle5012bPipeline();
+
+		/*!
+		* Starts the pipeline with the first frame. Until stop, the SPIC of the
+		* sensor must not be used for other frames.
+		* @param [in] command register address with the number of registers (ND) to read, e.g. REG_AVAL | 0x0003
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type, INTERFACE_ACCESS_ERROR if the frame can not be started
+		*/
+		errorTypes start(uint16_t command, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Returns the frame on the wire and starts the next one before the
+		* returned frame is checked. After a system or CRC error the frame in
+		* flight is dropped, the safety word is reset and the pipeline restarts.
+		* @param [out] data buffer for the number of registers set with start, zero on error
+		* @return CRC error type
+		*/
+		errorTypes read(uint16_t data[]);
+
+		/*!
+		* Waits for the frame in flight and stops the pipeline
+		* @return CRC error type
+		*/
+		errorTypes stop();
+
+		//!< \brief true between start and stop
+		bool isRunning() const;
+
+		//!< \brief returns the instrumentation counters
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the instrumentation counters
+		void clearStats();
+
+	private:
+
+		Tle5012b        &sensor_;                            //!< \brief sensor of the pipeline
+		uint16_t        buffer_[2][PIPELINE_FRAME_WORDS];    //!< \brief response buffers, one on the wire, one decoded
+		uint16_t        command_;                            //!< \brief repeated command word
+		uint16_t        length_;                             //!< \brief number of data words per frame
+		safetyTypes     safe_;                               //!< \brief safety word requested
+		uint8_t         active_;                             //!< \brief buffer of the frame on the wire
+		bool            running_;                            //!< \brief a frame is on the wire
+		Stats_t         stats_;                              //!< \brief instrumentation
+
+		errorTypes issue();
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_PIPELINE_HPP */
@@ -0,0 +1,291 @@
+/*!
+ * \file        tle5012b_pwm.cpp
+ * \name        tle5012b_pwm.cpp - PWM interface decoder for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_pwm.hpp"
+
+PWMDecoder::PWMDecoder():
+	glitch_(0),
+	sequence_(0)
+{
+	configure(0, 1000000UL);
+}
+
+void PWMDecoder::configure(uint8_t ifabres, uint32_t tickRate, uint8_t tolerance)
+{
+	Snapshot_t snap;
+	nominal_ = (uint32_t) (((uint64_t) tickRate * (PWM_PERIOD_US >> (ifabres & 0x03))) / 1000000UL);
+	tolerance_ = (nominal_ * tolerance) / 100;
+	started_ = false;
+	haveRise_ = false;
+	haveFall_ = false;
+	pending_ = false;
+	undo_.haveRise = false;
+	undo_.haveFall = false;
+	snap.raw = 0;
+	snap.status = INTERFACE_ACCESS_ERROR;
+	snap.lastFrame = 0;
+	snap.valid = false;
+	publish(snap);
+	clearStats();
+}
+
+void PWMDecoder::snapshot(Snapshot_t &snap) const
+{
+	uint16_t sequence;
+	do
+	{
+		// an edge during the copy rewrites the buffer, so copy again
+		sequence = sequence_;
+		const volatile Snapshot_t &shot = shot_[sequence & 0x01];
+		snap.raw = shot.raw;
+		snap.status = shot.status;
+		snap.lastFrame = shot.lastFrame;
+		snap.valid = shot.valid;
+	} while (sequence != sequence_);
+}
+
+void PWMDecoder::publish(const Snapshot_t &snap)
+{
+	// write the unused buffer, a reader interrupting us still sees the old one
+	uint16_t next = sequence_ + 1;
+	volatile Snapshot_t &shot = shot_[next & 0x01];
+	shot.raw = snap.raw;
+	shot.status = snap.status;
+	shot.lastFrame = snap.lastFrame;
+	shot.valid = snap.valid;
+	sequence_ = next;
+}
+
+void PWMDecoder::setGlitchFilter(uint32_t ticks)
+{
+	glitch_ = ticks;
+}
+
+void PWMDecoder::edge(bool level, uint32_t timestamp)
+{
+	bool glitch = started_ && (level != level_) && (glitch_ != 0) && ((timestamp - last_) < glitch_);
+	if (pending_ && !glitch)
+	{
+		// the short frame was no glitch
+		pending_ = false;
+		decode(pendHigh_, pendPeriod_, false, 0);
+	}
+
+	if (started_ && (level == level_))
+	{
+		// the opposite edge was missed, restart the frame with this edge
+		Snapshot_t snap;
+		snapshot(snap);
+		snap.status = INTERFACE_ACCESS_ERROR;
+		publish(snap);
+		stats_.frameErrors++;
+		haveRise_ = level;
+		haveFall_ = false;
+		rise_ = timestamp;
+		last_ = timestamp;
+		return;
+	}
+	if (glitch)
+	{
+		// remove the short pulse together with its first edge
+		stats_.glitches++;
+		level_ = level;
+		rise_ = undo_.rise;
+		fall_ = undo_.fall;
+		last_ = undo_.last;
+		haveRise_ = undo_.haveRise;
+		haveFall_ = undo_.haveFall;
+		pending_ = false;
+		return;
+	}
+	undo_.rise = rise_;
+	undo_.fall = fall_;
+	undo_.last = last_;
+	undo_.haveRise = haveRise_;
+	undo_.haveFall = haveFall_;
+	level_ = level;
+	last_ = timestamp;
+	started_ = true;
+
+	if (level)
+	{
+		if (haveRise_ && haveFall_)
+		{
+			uint32_t high = fall_ - rise_;
+			uint32_t period = timestamp - rise_;
+			if ((glitch_ != 0) && (period + tolerance_ < nominal_))
+			{
+				// may be the start of a glitch, decided with the next edge
+				pending_ = true;
+				pendHigh_ = high;
+				pendPeriod_ = period;
+			}else{
+				decode(high, period, true, timestamp);
+			}
+		}
+		rise_ = timestamp;
+		haveRise_ = true;
+		haveFall_ = false;
+	}else if (haveRise_)
+	{
+		fall_ = timestamp;
+		haveFall_ = true;
+	}
+}
+
+errorTypes PWMDecoder::frame(uint32_t high, uint32_t period)
+{
+	return (decode(high, period, false, 0));
+}
+
+/*!
+* Decodes one frame and publishes the result
+* @param [in] high high time in ticks
+* @param [in] period frame period in ticks, rising to rising edge
+* @param [in] stamp a valid frame sets the time of the last valid frame
+* @param [in] timestamp time of the rising edge which ended the frame
+* @return CRC error type of the frame
+*/
+errorTypes PWMDecoder::decode(uint32_t high, uint32_t period, bool stamp, uint32_t timestamp)
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	if ((period == 0) || (high >= period) || (period + tolerance_ < nominal_) || (period > nominal_ + tolerance_))
+	{
+		stats_.frameErrors++;
+		snap.status = INTERFACE_ACCESS_ERROR;
+		publish(snap);
+		return (snap.status);
+	}
+
+	uint32_t duty = (uint32_t) ((((uint64_t) high * PWM_FRAME_TICKS) + (period / 2)) / period);
+	if ((duty < PWM_DUTY_MIN) || (duty > PWM_DUTY_MAX))
+	{
+		stats_.diagnostics++;
+		snap.status = SYSTEM_ERROR;
+		publish(snap);
+		return (snap.status);
+	}
+
+	// angle = (high / period - 6.25 %) / 87.5 % in 2^15 digits per revolution
+	int64_t num = ((int64_t) high * PWM_FRAME_TICKS) - ((int64_t) PWM_DUTY_MIN * period);
+	uint64_t den = (uint64_t) (PWM_DUTY_MAX - PWM_DUTY_MIN) * period;
+	if (num < 0)
+	{
+		num = 0;
+	}
+	uint32_t raw = (uint32_t) ((((uint64_t) num << 15) + (den / 2)) / den) & DELETE_BIT_15;
+	if (raw & CHECK_BIT_14)
+	{
+		raw -= CHANGE_UINT_TO_INT_15;
+	}
+	snap.raw = (int16_t) raw;
+	snap.status = NO_ERROR;
+	if (stamp)
+	{
+		snap.lastFrame = timestamp;
+		snap.valid = true;
+	}
+	publish(snap);
+	stats_.frames++;
+	return (snap.status);
+}
+
+errorTypes PWMDecoder::getRawAngle(int16_t &rawAngleValue)
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	rawAngleValue = snap.raw;
+	return (snap.status);
+}
+
+errorTypes PWMDecoder::getAngleValue(double &angleValue)
+{
+	int16_t rawAngleValue = 0;
+	errorTypes status = getRawAngle(rawAngleValue);
+	angleValue = (ANGLE_360_VAL / POW_2_15) * ((double) rawAngleValue);
+	return (status);
+}
+
+bool PWMDecoder::isStale(uint32_t now) const
+{
+	Snapshot_t snap;
+	snapshot(snap);
+	return (!snap.valid || ((now - snap.lastFrame) > (2 * nominal_)));
+}
+
+const PWMDecoder::Stats_t &PWMDecoder::getStats() const
+{
+	return (stats_);
+}
+
+void PWMDecoder::clearStats()
+{
+	stats_.frames = 0;
+	stats_.frameErrors = 0;
+	stats_.glitches = 0;
+	stats_.diagnostics = 0;
+}
+
+
+Tle5012bPWM::Tle5012bPWM(Capture &capture, uint8_t channel):
+	capture_(capture),
+	channel_(channel)
+{
+}
+
+Tle5012bPWM::~Tle5012bPWM()
+{
+	end();
+}
+
+void Tle5012bPWM::onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg)
+{
+	Tle5012bPWM *pwm = (Tle5012bPWM *) arg;
+	if (channel == pwm->channel_)
+	{
+		pwm->decoder_.edge(level, timestamp);
+	}
+}
+
+errorTypes Tle5012bPWM::begin(uint8_t ifabres, uint16_t glitch)
+{
+	uint32_t rate = capture_.tickRate();
+	decoder_.configure(ifabres, rate);
+	decoder_.setGlitchFilter((uint32_t) (((uint64_t) glitch * rate) / 1000000UL));
+	if (capture_.init(onEdge, this) != Capture::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	return (NO_ERROR);
+}
+
+void Tle5012bPWM::end()
+{
+	capture_.deinit();
+}
+
+errorTypes Tle5012bPWM::getAngleValue(double &angleValue)
+{
+	errorTypes status = decoder_.getAngleValue(angleValue);
+	if (decoder_.isStale(capture_.now()))
+	{
+		status = INTERFACE_ACCESS_ERROR;
+	}
+	return (status);
+}
+
+PWMDecoder &Tle5012bPWM::decoder()
+{
+	return (decoder_);
+}
@@ -0,0 +1,198 @@
+/*!
+ * \file        tle5012b_pwm.hpp
+ * \name        tle5012b_pwm.hpp - PWM interface decoder for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              In PWM mode the sensor outputs the angle as duty cycle on IFA. 0° is a
+ *              duty cycle of 6.25 %, 360° of 93.75 %, duty cycles outside this range
+ *              signal a sensor error. The frame period is 4096 µs at IFABRES 0 and halves
+ *              with each IFABRES step. The PWMDecoder turns timestamped edges into the
+ *              signed 15 bit raw angle of AVAL with integer math only. It has no hardware
+ *              dependency and can be fed with recorded timing vectors. Tle5012bPWM
+ *              connects the decoder with a capture PAL, no SPI is needed.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_PWM_HPP
+#define TLE5012B_PWM_HPP
+
+#include "../pal/capture.hpp"
+#include "TLE5012b.hpp"
+
+#define PWM_FRAME_TICKS        4096U    //!< \brief duty cycle resolution of one PWM frame
+#define PWM_DUTY_MIN           256U     //!< \brief duty cycle of 0°, 6.25 % of the frame
+#define PWM_DUTY_MAX           3840U    //!< \brief duty cycle of 360°, 93.75 % of the frame
+#define PWM_PERIOD_US          4096U    //!< \brief frame period in µs at IFABRES 0
+#define PWM_TOLERANCE          10U      //!< \brief default frame period tolerance in percent
+
+/**
+ * @addtogroup tle5012pwm
+ *
+ * @{
+ */
+
+class PWMDecoder
+{
+	public:
+
+		//!< \brief decoder statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t frames;         //!< \brief number of valid frames
+			uint32_t frameErrors;    //!< \brief frames with a period out of tolerance or a missing edge
+			uint32_t glitches;       //!< \brief pulses shorter than the glitch filter
+			uint32_t diagnostics;    //!< \brief frames with a duty cycle outside the angle range
+		};
+
+		PWMDecoder();
+
+		/*!
+		* Sets the expected frame period and resets the decoder
+		* @param [in] ifabres IFABRES value of MOD_4, 0 = 244 Hz ... 3 = 1953 Hz
+		* @param [in] tickRate timestamp ticks per second
+		* @param [in] tolerance allowed frame period deviation in percent
+		*/
+		void configure(uint8_t ifabres, uint32_t tickRate, uint8_t tolerance=PWM_TOLERANCE);
+
+		/*!
+		* Sets the glitch filter. Pulses shorter than the filter are removed
+		* together with their opposite edge.
+		* @param [in] ticks minimum pulse width in timestamp ticks, 0 switches the filter off
+		*/
+		void setGlitchFilter(uint32_t ticks);
+
+		/*!
+		* Feeds one edge of IFA into the decoder, can be called from interrupt context
+		* @param [in] level level after the edge
+		* @param [in] timestamp edge time in ticks
+		*/
+		void edge(bool level, uint32_t timestamp);
+
+		/*!
+		* Decodes one frame from its high time and period
+		* @param [in] high high time in ticks
+		* @param [in] period frame period in ticks, rising to rising edge
+		* @return CRC error type, INTERFACE_ACCESS_ERROR for a frame error,
+		*         SYSTEM_ERROR for a diagnostic duty cycle
+		*/
+		errorTypes frame(uint32_t high, uint32_t period);
+
+		/*!
+		* Returns the angle of the last valid frame
+		* @param [out] rawAngleValue signed 15 bit raw angle value, same unit than AVAL
+		* @return CRC error type of the last frame, INTERFACE_ACCESS_ERROR before the first frame
+		*/
+		errorTypes getRawAngle(int16_t &rawAngleValue);
+
+		/*!
+		* Returns the angle of the last valid frame
+		* @param [out] angleValue angle in degrees -180 to 180, same range than getAngleValue
+		* @return CRC error type of the last frame
+		*/
+		errorTypes getAngleValue(double &angleValue);
+
+		/*!
+		* Checks if frames are missing, e.g. a line break or a stuck output
+		* @param [in] now actual time in ticks
+		* @return true if no valid frame was decoded for two periods
+		*/
+		bool isStale(uint32_t now) const;
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics
+		void clearStats();
+
+	private:
+
+		uint32_t            nominal_;      //!< \brief expected frame period in ticks
+		uint32_t            tolerance_;    //!< \brief allowed period deviation in ticks
+		uint32_t            glitch_;       //!< \brief minimum pulse width in ticks
+		uint32_t            rise_;         //!< \brief time of the rising edge which started the frame
+		uint32_t            fall_;         //!< \brief time of the falling edge of the frame
+		uint32_t            last_;         //!< \brief time of the last edge
+		uint32_t            pendHigh_;     //!< \brief high time of a too short frame, held for the glitch filter
+		uint32_t            pendPeriod_;   //!< \brief period of a too short frame
+		bool                level_;        //!< \brief level after the last edge
+		bool                started_;      //!< \brief level_ is known
+		bool                haveRise_;     //!< \brief rise_ is valid
+		bool                haveFall_;     //!< \brief fall_ is valid
+		bool                pending_;      //!< \brief a too short frame is held
+
+		//!< \brief frame state before the last edge, restored if it was a glitch
+		struct Undo_t
+		{
+			uint32_t rise;
+			uint32_t fall;
+			uint32_t last;
+			bool     haveRise;
+			bool     haveFall;
+		} undo_;
+
+		//!< \brief frame result written by edge, double buffered for readers in any context
+		struct Snapshot_t
+		{
+			int16_t     raw;             //!< \brief raw angle of the last valid frame
+			errorTypes  status;          //!< \brief result of the last frame
+			uint32_t    lastFrame;       //!< \brief time of the last valid frame
+			bool        valid;           //!< \brief lastFrame is valid
+		};
+
+		volatile Snapshot_t shot_[2];      //!< \brief the valid snapshot is selected by the lowest sequence bit
+		volatile uint16_t   sequence_;     //!< \brief incremented after each completed update
+		Stats_t             stats_;        //!< \brief decoder statistics
+
+		errorTypes decode(uint32_t high, uint32_t period, bool stamp, uint32_t timestamp);
+		void snapshot(Snapshot_t &snap) const;
+		void publish(const Snapshot_t &snap);
+};
+
+class Tle5012bPWM
+{
+	public:
+
+		Tle5012bPWM(Capture &capture, uint8_t channel=0);
+		~Tle5012bPWM();
+
+		/*!
+		* Starts the capture of the PWM output
+		* @param [in] ifabres IFABRES value of MOD_4 as set in the sensor
+		* @param [in] glitch glitch filter in µs
+		* @return CRC error type, INTERFACE_ACCESS_ERROR if the capture fails
+		*/
+		errorTypes begin(uint8_t ifabres=0, uint16_t glitch=2);
+
+		//!< \brief stops the capture
+		void end();
+
+		/*!
+		* Returns the angle of the last PWM frame
+		* @param [out] angleValue angle in degrees -180 to 180
+		* @return CRC error type, INTERFACE_ACCESS_ERROR if the frames are stale
+		*/
+		errorTypes getAngleValue(double &angleValue);
+
+		//!< \brief the decoder with statistics
+		PWMDecoder &decoder();
+
+	private:
+
+		Capture     &capture_;       //!< \brief edge capture of IFA
+		uint8_t     channel_;        //!< \brief capture channel of IFA
+		PWMDecoder  decoder_;        //!< \brief PWM decoder
+
+		static void onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_PWM_HPP */
@@ -0,0 +1,115 @@
+/*!
+ * \file        tle5012b_recovery.cpp
+ * \name        tle5012b_recovery.cpp - fast fault recovery for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_recovery.hpp"
+
+Tle5012bRecovery::Tle5012bRecovery(Tle5012b &sensor, ConfigShadow &shadow):
+	sensor_(sensor),
+	shadow_(shadow),
+	timer_(NULL),
+	detected_(0),
+	pending_(false)
+{
+	clearStats();
+}
+
+void Tle5012bRecovery::setTimer(Timer *timer)
+{
+	timer_ = timer;
+	if (timer_ != NULL)
+	{
+		timer_->start();
+	}
+}
+
+uint32_t Tle5012bRecovery::now()
+{
+	uint32_t elapsed = 0;
+	if (timer_ != NULL)
+	{
+		timer_->elapsed(elapsed);
+	}
+	return (elapsed);
+}
+
+errorTypes Tle5012bRecovery::check(errorTypes status)
+{
+	if (!pending_)
+	{
+		if ((status != SYSTEM_ERROR) && !(sensor_.safetyWord & RESET_INDICATION_MASK))
+		{
+			return (status);
+		}
+		pending_ = true;
+		detected_ = now();
+		stats_.resets++;
+	}
+	return (recover());
+}
+
+errorTypes Tle5012bRecovery::poll()
+{
+	uint16_t stat = 0;
+	errorTypes status = sensor_.readStatus(stat);
+	return (check(status));
+}
+
+errorTypes Tle5012bRecovery::recover()
+{
+	uint8_t count = 0;
+	if (!pending_)
+	{
+		detected_ = now();
+	}
+	// STAT read clears the reset indication, otherwise the next check would restore again
+	uint16_t stat = 0;
+	sensor_.readStatus(stat);
+	errorTypes status = shadow_.restore(sensor_, count);
+	stats_.writes += count;
+	if (status != NO_ERROR)
+	{
+		pending_ = true;
+		stats_.failures++;
+		return (status);
+	}
+	pending_ = false;
+	stats_.restores++;
+	stats_.lastWrites = count;
+	stats_.lastTime = now() - detected_;
+	if (stats_.lastTime > stats_.maxTime)
+	{
+		stats_.maxTime = stats_.lastTime;
+	}
+	return (NO_ERROR);
+}
+
+bool Tle5012bRecovery::pending() const
+{
+	return (pending_);
+}
+
+const Tle5012bRecovery::Stats_t &Tle5012bRecovery::getStats() const
+{
+	return (stats_);
+}
+
+void Tle5012bRecovery::clearStats()
+{
+	stats_.resets = 0;
+	stats_.restores = 0;
+	stats_.failures = 0;
+	stats_.writes = 0;
+	stats_.lastWrites = 0;
+	stats_.lastTime = 0;
+	stats_.maxTime = 0;
+}
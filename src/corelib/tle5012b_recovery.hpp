@@ -0,0 +1,103 @@
+/*!
+ * \file        tle5012b_recovery.hpp
+ * \name        tle5012b_recovery.hpp - fast fault recovery for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              After a chip reset, a watchdog overflow or a firmware reset the sensor
+ *              starts again with the fuse defaults and the application configuration is
+ *              lost. The recovery watches the status of each read: a SYSTEM_ERROR or the
+ *              reset indication (STAT_RES) in the safety word starts a restore of the
+ *              configuration from a ConfigShadow. The restore needs two reads and only
+ *              the writes of lost registers, with one CRC write at the end. A failed
+ *              restore stays pending and is repeated with the next check.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_RECOVERY_HPP
+#define TLE5012B_RECOVERY_HPP
+
+#include "tle5012b_shadow.hpp"
+
+/**
+ * @addtogroup tle5012recovery
+ *
+ * @{
+ */
+
+class Tle5012bRecovery
+{
+	public:
+
+		//!< \brief statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t resets;         //!< \brief detected resets and system errors
+			uint32_t restores;       //!< \brief finished restores
+			uint32_t failures;       //!< \brief failed restore attempts
+			uint32_t writes;         //!< \brief written registers of all restores
+			uint8_t  lastWrites;     //!< \brief written registers of the last restore
+			uint32_t lastTime;       //!< \brief time from detection to finished restore in milliseconds, only with timer
+			uint32_t maxTime;        //!< \brief longest time to recover in milliseconds, only with timer
+		};
+
+		Tle5012bRecovery(Tle5012b &sensor, ConfigShadow &shadow);
+
+		/*!
+		* Sets a timer to measure the time to recover, the timer is started
+		* @param [in] timer running timer or NULL
+		*/
+		void setTimer(Timer *timer);
+
+		/*!
+		* Checks the result of a sensor read. Without error and reset
+		* indication there is no bus access.
+		* @param [in] status error type of the last read
+		* @return status if no restore was needed, otherwise the result of the restore
+		*/
+		errorTypes check(errorTypes status);
+
+		/*!
+		* Reads STAT with safety word and checks it, for idle times
+		* without other reads
+		* @return CRC error type
+		*/
+		errorTypes poll();
+
+		/*!
+		* Restores the configuration at once
+		* @return CRC error type
+		*/
+		errorTypes recover();
+
+		//!< \brief true while a restore is outstanding
+		bool pending() const;
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics
+		void clearStats();
+
+	private:
+
+		Tle5012b        &sensor_;        //!< \brief observed sensor
+		ConfigShadow    &shadow_;        //!< \brief configuration to restore
+		Timer           *timer_;         //!< \brief optional timer for the time to recover
+		uint32_t        detected_;       //!< \brief timer value of the detection
+		bool            pending_;        //!< \brief restore outstanding
+		Stats_t         stats_;          //!< \brief statistics
+
+		uint32_t now();
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_RECOVERY_HPP */
@@ -46,119 +46,39 @@ const Reg::AddressField_t Reg::addrFields[] =
 	{REG_T25O,    22    },    //!< \brief T25O temperature 25°c offset value
 };
 
-const Reg::BitField_t Reg::bitFields[] =
-{
-	{REG_ACCESS_RU,  REG_STAT,    0x2,    1,  0x00,  0},       //!< 00 bits 0:0 SRST status watch dog
-	{REG_ACCESS_R,   REG_STAT,    0x2,    1,  0x00,  0},       //!< 01 bits 1:1 SWD status watch dog
-	{REG_ACCESS_R,   REG_STAT,    0x4,    2,  0x00,  0},       //!< 02 bits 2:2 SVR status voltage regulator
-	{REG_ACCESS_R,   REG_STAT,    0x8,    3,  0x00,  0},       //!< 03 bits 3:3 SFUSE status fuses
-	{REG_ACCESS_R,   REG_STAT,    0x10,   4,  0x00,  0},       //!< 04 bits 4:4 SDSPU status digital signal processing unit
-	{REG_ACCESS_RU,  REG_STAT,    0x20,   5,  0x00,  0},       //!< 05 bits 5:5 SOV status overflow
-	{REG_ACCESS_RU,  REG_STAT,    0x40,   6,  0x00,  0},       //!< 06 bits 6:6 SXYOL status X/Y data out limit
-	{REG_ACCESS_RU,  REG_STAT,    0x80,   7,  0x00,  0},       //!< 07 bits 7:7 SMAGOL status magnitude out limit
-	{REG_ACCESS_RES, REG_STAT,    0x100,  8,  0x00,  0},       //!< 08 bits 8:8 reserved
-	{REG_ACCESS_R,   REG_STAT,    0x200,  9,  0x00,  0},       //!< 09 bits 9:9 SADCT status ADC test
-	{REG_ACCESS_R,   REG_STAT,    0x400,  10, 0x00,  0},       //!< 10 bits 10:10 SROM status ROM
-	{REG_ACCESS_RU,  REG_STAT,    0x800,  11, 0x00,  0},       //!< 11 bits 11:11 NOGMRXY no valid GMR XY Values
-	{REG_ACCESS_RU,  REG_STAT,    0x1000, 12, 0x00,  0},       //!< 12 bits 12:12 NOGMRA no valid GMR Angle Value
-	{REG_ACCESS_RW,  REG_STAT,    0x6000, 13, 0x00,  0},       //!< 13 bits 14:13 SNR slave number
-	{REG_ACCESS_RU,  REG_STAT,    0x8000, 15, 0x00,  0},       //!< 14 bits 15:15 RDST read status
-
-	{REG_ACCESS_RW,  REG_ACSTAT,  0x1,    0,  0x00,  1},       //!< 15 bits 0:0 ASRST Activation of Hardware Reset
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x2,    1,  0x00,  1},       //!< 16 bits 1:1 ASWD Enable DSPU Watch dog
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x4,    2,  0x00,  1},       //!< 17 bits 2:2 ASVR Enable Voltage regulator Check
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x8,    3,  0x00,  1},       //!< 18 bits 3:3 ASFUSE Activation Fuse CRC
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x10,   4,  0x00,  1},       //!< 19 bits 4:4 ASDSPU Activation DSPU BIST
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x20,   5,  0x00,  1},       //!< 20 bits 5:5 ASOV Enable of DSPU Overflow Check
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x40,   6,  0x00,  1},       //!< 21 bits 6:6 ASVECXY Activation of X,Y Out of Limit-Check
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x80,   7,  0x00,  1},       //!< 22 bits 7:7 ASVEGMAG Activation of Magnitude Check
-	{REG_ACCESS_RES, REG_ACSTAT,  0x100,  8,  0x00,  1},       //!< 23 bits 8:8 Reserved
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x200,  9,  0x00,  1},       //!< 24 bits 9:9 ASADCT Enable ADC Test vector Check
-	{REG_ACCESS_RWU, REG_ACSTAT,  0x400,  10, 0x00,  1},       //!< 25 bits 10:10 ASFRST Activation of Firmware Reset
-	{REG_ACCESS_RES, REG_ACSTAT,  0xF800, 11, 0x00,  1},       //!< 26 bits 15:11 Reserved
-
-	{REG_ACCESS_RU,  REG_AVAL,    0x7FFF, 0,  0x00,  2},       //!< 27 bits 14:0 ANGVAL Calculated Angle Value (signed 15-bit)
-	{REG_ACCESS_R,   REG_AVAL,    0x8000, 15, 0x00,  2},       //!< 28 bits 15:15 RDAV Read Status, Angle Value
-
-	{REG_ACCESS_RU,  REG_ASPD,    0x7FFF, 0,  0x00,  3},       //!< 29 bits 14:0 ANGSPD Signed value, where the sign bit [14] indicates the direction of the rotation
-	{REG_ACCESS_R,   REG_ASPD,    0x8000, 15, 0x00,  3},       //!< 30 bits 15:15 RDAS Read Status, Angle Speed
-
-	{REG_ACCESS_RU,  REG_AREV,    0xFF,   0,  0x00,  4},       //!< 31 bits 8:0 REVOL Revolution counter. Increments for every full rotation in counter-clockwise direction
-	{REG_ACCESS_RWU, REG_AREV,    0x7E00, 9,  0x00,  4},       //!< 32 bits 14:9 FCNT Internal frame counter. Increments every update period
-	{REG_ACCESS_R,   REG_AREV,    0x8000, 15, 0x00,  4},       //!< 33 its 15:15 RDREV Read Status, Revolution
-
-	{REG_ACCESS_RWU, REG_FSYNC,   0xFF,   0,  0x00,  5},       //!< 34 bits 8:0 TEMPR Signed offset compensated temperature value
-	{REG_ACCESS_RU,  REG_FSYNC,   0xFE00, 9,  0x00,  5},       //!< 35 bits 15:9 FSYNC Frame Synchronization Counter Value
-
-	{REG_ACCESS_RW,  REG_MOD_1,   0x3,    0,  0x00,  6},       //!< 36 bits 1:0 IIFMOD Incremental Interface Mode
-	{REG_ACCESS_RW,  REG_MOD_1,   0x4,    2,  0x00,  6},       //!< 37 bits 2:2 DSPUHOLD if DSPU is on hold, no watch dog reset is performed by DSPU
-	{REG_ACCESS_RES, REG_MOD_1,   0x8,    3,  0x00,  6},       //!< 38 bits 3:3 Reserved1
-	{REG_ACCESS_RW,  REG_MOD_1,   0x10,   4,  0x00,  6},       //!< 39 bits 4:4 CLKSEL switch to external clock at start-up only
-	{REG_ACCESS_RES, REG_MOD_1,   0x3FE0, 5,  0x00,  6},       //!< 40 bits 13:5 Reserved2
-	{REG_ACCESS_RW,  REG_MOD_1,   0x6000, 13, 0x00,  6},       //!< 41 bits 15:14 FIRMD Update Rate Setting
-
-	{REG_ACCESS_RW,  REG_SIL,     0x7,    0,  0x00,  7},       //!< 42 bits 2:0 ADCTVX Test vector X
-	{REG_ACCESS_RW,  REG_SIL,     0x38,   3,  0x00,  7},       //!< 43 bits 5:3 ADCTVY Test vector Y
-	{REG_ACCESS_RW,  REG_SIL,     0x40,   6,  0x00,  7},       //!< 44 bits 6:6 ADCTVEN Sensor elements are internally disconnected and test voltages are connected to ADCs
-	{REG_ACCESS_RES, REG_SIL,     0x380,  7,  0x00,  7},       //!< 45 bits 9:7 Reserved1
-	{REG_ACCESS_RW,  REG_SIL,     0x400,  10, 0x00,  7},       //!< 46 bits 10:10 FUSEREL Triggers reload of default values from laser fuses into configuration registers
-	{REG_ACCESS_RES, REG_SIL,     0x3800, 11, 0x00,  7},       //!< 47 bits 13:11 Reserved2
-	{REG_ACCESS_RW,  REG_SIL,     0x4000, 14, 0x00,  7},       //!< 48 bits 14:14 FILTINV the X- and Y-signals are inverted. The angle output is then shifted by 180°
-	{REG_ACCESS_RW,  REG_SIL,     0x8000, 15, 0x00,  7},       //!< 49 bits 15:15 FILTPAR the raw X-signal is routed also to the raw Y-signal input of the filter so SIN and COS signal should be identical
-
-	{REG_ACCESS_RW,  REG_MOD_2,   0x3,    0,  0x00,  8},       //!< 50 bits 1:0 AUTOCAL Automatic calibration of offset and amplitude synchronicity for applications with full-turn
-	{REG_ACCESS_RW,  REG_MOD_2,   0x4,    2,  0x00,  8},       //!< 51 bits 2:2 PREDICT Prediction of angle value based on current angle speed
-	{REG_ACCESS_RW,  REG_MOD_2,   0x8,    3,  0x00,  8},       //!< 52 bits 3:3 ANGDIR Inverts angle and angle speed values and revolution counter behavior
-	{REG_ACCESS_RW,  REG_MOD_2,   0x7FF0, 4,  0x00,  8},       //!< 53 bits 14:4 ANGRANGE Changes the representation of the angle output by multiplying the output with a factor ANG_RANGE/128
-	{REG_ACCESS_RES, REG_MOD_2,   0x8000, 15, 0x00,  8},       //!< 54 bits 15:15 Reserved1
-
-	{REG_ACCESS_RW,  REG_MOD_3,   0x3,    0,  0x00,  9},       //!< 55 bits 1:0 PADDRV Configuration of Pad-Driver
-	{REG_ACCESS_RW,  REG_MOD_3,   0x4,    2,  0x00,  9},       //!< 56 bits 2:2 SSCOD SSC-Interface Data Pin Output Mode
-	{REG_ACCESS_RW,  REG_MOD_3,   0x8,    3,  0x00,  9},       //!< 57 bits 3:3 SPIKEF Filters voltage spikes on input pads (IFC, SCK and CSQ)
-	{REG_ACCESS_RW,  REG_MOD_3,   0xFFF0, 4,  0x00,  9},       //!< 58 bits 15:4 ANG_BASE Sets the 0° angle position (12 bit value). Angle base is factory-calibrated to make the 0° direction parallel to the edge of the chip
-
-	{REG_ACCESS_RES, REG_OFFX,    0xF,    0,  0x00, 10},       //!< 59 bits 3:0 Reserved1
-	{REG_ACCESS_RW,  REG_OFFX,    0xFFF0, 4,  0x00, 10},       //!< 60 bits 15:4 XOFFSET 12-bit signed integer value of raw X-signal offset correction at 25°C
-
-	{REG_ACCESS_RES, REG_OFFY,    0xF,    0,  0x00, 11},       //!< 61 bits 3:0 Reserved1
-	{REG_ACCESS_RW,  REG_OFFY,    0xFFF0, 4,  0x00, 11},       //!< 62 bits 15:4 YOFFSET 12-bit signed integer value of raw Y-signal offset correction at 25°C
-
-	{REG_ACCESS_RES, REG_SYNCH,   0xF,    0,  0x00, 12},       //!< 63 bits 3:0 Reserved1
-	{REG_ACCESS_RW,  REG_SYNCH,   0xFFF0, 4,  0x00, 12},       //!< 64 bits 15:4 SYNCH 12-bit signed integer value of amplitude synchronicity
-
-	{REG_ACCESS_RW,  REG_IFAB,    0x3,    0,  0x00, 13},       //!< 65 bits 1:0 IFADHYST Hysteresis (multi-purpose)
-	{REG_ACCESS_RW,  REG_IFAB,    0x4,    2,  0x00, 13},       //!< 66 bits 2:2 IFABOD IFA,IFB,IFC Output Mode
-	{REG_ACCESS_RW,  REG_IFAB,    0x8,    3,  0x00, 13},       //!< 67 bits 3:3 FIRUDR Initial filter update rate (FIR)
-	{REG_ACCESS_RW,  REG_IFAB,    0xFFF0, 4,  0x00, 13},       //!< 68 bits 15:4 ORTHO Orthogonality Correction of X and Y Components
-
-	{REG_ACCESS_RW,  REG_MOD_4,   0x3,    0,  0x00, 14},       //!< 69 bits 1:0 IFMD Interface Mode on IFA,IFB,IFC
-	{REG_ACCESS_RES, REG_MOD_4,   0x4,    2,  0x00, 14},       //!< 70 bits 2:2 Reserved1
-	{REG_ACCESS_RW,  REG_MOD_4,   0x18,   3,  0x00, 14},       //!< 71 bits 4:3 IFABRES IIF resolution (multi-purpose)
-	{REG_ACCESS_RW,  REG_MOD_4,   0x1E0,  5,  0x00, 14},       //!< 72 bits 8:5 HSMPLP Hall Switch mode (multi-purpose)
-	{REG_ACCESS_RW,  REG_MOD_4,   0x7E00, 9,  0x00, 14},       //!< 73 bits 15:9 TCOXT 7-bit signed integer value of X-offset temperature coefficient
-
-	{REG_ACCESS_RW,  REG_TCO_Y,   0x7F,   0,  0x00, 15},       //!< 74 bits 7:0 CRCPAR CRC of Parameters
-	{REG_ACCESS_RW,  REG_TCO_Y,   0x80,   8,  0x00, 15},       //!< 75 bits 8:8 SBIST Startup-BIST
-	{REG_ACCESS_RW,  REG_TCO_Y,   0x7E00, 9,  0x00, 15},       //!< 76 bits 15:9 TCOYT 7-bit signed integer value of Y-offset temperature coefficient
-
-	{REG_ACCESS_R,   REG_ADC_X,   0xFFFF, 0,  0x00, 16},       //!< 77 bits 15:0 ADCX ADC value of X-GMR
-
-	{REG_ACCESS_R,   REG_ADC_Y,   0xFFFF, 0,  0x00, 17},       //!< 78 bits 15:0 ADCY ADC value of Y-GMR
-
-	{REG_ACCESS_RU,  REG_D_MAG,   0x3FF,  0,  0x00, 18},       //!< 79 bits 9:0 MAG Unsigned Angle Vector Magnitude after X, Y error compensation (due to temperature)
-	{REG_ACCESS_RES, REG_D_MAG,   0xFC00, 10, 0x00, 18},       //!< 80 bits 15:10 Reserved1
-
-	{REG_ACCESS_RU,  REG_T_RAW,   0x3FF,  0,  0x00, 19},       //!< 81 bits 9:0 TRAW Temperature Sensor Raw-Value at ADC without offset
-	{REG_ACCESS_RES, REG_T_RAW,   0xFC00, 10, 0x00, 19},       //!< 82 bits 14:10 Reserved1
-	{REG_ACCESS_RU,  REG_T_RAW,   0x8000, 15, 0x00, 19},       //!< 83 bits 15:15 TTGL Temperature Sensor Raw-Value Toggle toggles after every new temperature value
-
-	{REG_ACCESS_RU,  REG_IIF_CNT, 0x7FFF, 0,  0x00, 20},       //!< 84 bits 14:0 IIFCNT 14 bit counter value of IIF increments
-	{REG_ACCESS_RES, REG_IIF_CNT, 0x8000, 15, 0x00, 20},       //!< 85 bits 15:14 Reserved1
-
-	{REG_ACCESS_R,   REG_T25O,    0x1FFF, 0,  0x00, 21},       //!< 86 bit 8:0 T250 Signed offset value at 25°C temperature; 1dig=0.36°C
-	{REG_ACCESS_RES, REG_T25O,    0xFE00, 9,  0x00, 21},       //!< 87 bits 15:9 Reserved1
+const Reg::Signature_t Reg::signatures[] =
+{
+	{TLE5012B_E1000, IIF, 0x0000, 0x0000},    //!< \brief E1000 incremental interface
+	{TLE5012B_E3005, HSM, 0x0000, 0x0000},    //!< \brief E3005 hall switch mode
+	{TLE5012B_E5000, PWM, 0x000C, 0x0004},    //!< \brief E5000 PWM with fast FIR update and IFABOD set
+	{TLE5012B_E5020, PWM, 0x0000, 0x0000},    //!< \brief E5020 any other PWM setup
+	{TLE5012B_E9000, SPC, 0x0000, 0x0000},    //!< \brief E9000 short PWM code
 };
 
+const uint8_t Reg::numSignatures = sizeof(Reg::signatures) / sizeof(Reg::signatures[0]);
+
+/**
+ * @brief Identifies the sensor variant from MOD_4 and IFAB
+ *
+ * @param mod4  MOD_4 register value
+ * @param ifab  IFAB register value
+ * @param type  identified sensor variant
+ * @return true if a signature matches
+ */
+bool Reg::identify(uint16_t mod4, uint16_t ifab, sensorType_t &type)
+{
+	interfaceType_t iface = (interfaceType_t) REG_MOD_4_IFMD::extract(mod4);
+	for (uint8_t i = 0; i < numSignatures; i++)
+	{
+		if ((signatures[i].iface == iface) && ((ifab & signatures[i].ifabMask) == signatures[i].ifabValue))
+		{
+			type = signatures[i].type;
+			return (true);
+		}
+	}
+	return (false);
+}
+
 /**
  * @brief Construct a new Reg::Reg object
  *
@@ -176,55 +96,73 @@ Reg::~Reg()
 {
 }
 
+/**
+ * @brief       Reads a register into the regMap
+ *
+ * @param[in]   posMap      Position of the register in the regMap
+ * @param[in]   update      Trigger an update of the update buffer before reading
+ * @return      actual register value
+ */
+uint16_t Reg::readRegister(uint8_t posMap, bool update)
+{
+	Tle5012b *p = static_cast<Tle5012b*>(parent_);
+	if (p->sBus->lock() != SPIC::OK)
+	{
+		return regMap[posMap];
+	}
+	if (update)
+	{
+		p->sBus->triggerUpdate();
+	}
+	p->readFromSensor(addrFields[posMap].regAddress, regMap[posMap], UPD_low, SAFE_high);
+	p->sBus->unlock();
+	return regMap[posMap];
+}
+
+/**
+ * @brief       Merges a value into the regMap register and writes it to the sensor
+ *
+ * @param[in]   posMap      Position of the register in the regMap
+ * @param[in]   mask        Bit field mask of the changed bits
+ * @param[in]   value       Shifted bit field value
+ */
+void Reg::writeRegister(uint8_t posMap, uint16_t mask, uint16_t value)
+{
+	Tle5012b *p = static_cast<Tle5012b*>(parent_);
+	regMap[posMap] = (regMap[posMap] & ~mask) | (value & mask);
+	p->writeToSensor(addrFields[posMap].regAddress, regMap[posMap], true);
+}
+
 /**
  * @brief       Gets the bit field value
  *
- * @param[in]   bitField    Bit field parameters structure
+ * @tparam      F           Bit field descriptor, must be readable
  * @param[out]  bitFValue   Value of the bit field
  * @retval      TRUE if success
- * @retval      FALSE if register access denied
  * @pre         None
  */
-bool Reg::getBitField(BitField_t bitField, uint16_t &bitFValue)
+template <typename F>
+bool Reg::getBitField(uint16_t &bitFValue)
 {
-	bool err = false;
-	if ((REG_ACCESS_R & bitField.regAccess) == REG_ACCESS_R)
-	{
-		Tle5012b *p = static_cast<Tle5012b*>(parent_);
-		if ((REG_ACCESS_U & bitField.regAccess) == REG_ACCESS_U)
-		{
-			p->sBus->triggerUpdate();
-		}
-		p->readFromSensor(addrFields[bitField.posMap].regAddress, regMap[bitField.posMap], UPD_low, SAFE_high);
-		bitFValue = (( regMap[bitField.posMap] & bitField.mask) >> bitField.position);
-		err = true;
-	}
-
-	return err;
+	static_assert((F::regAccess & REG_ACCESS_R) == REG_ACCESS_R, "register bit field is not readable");
+	bitFValue = F::extract(readRegister(F::posMap, (F::regAccess & REG_ACCESS_U) == REG_ACCESS_U));
+	return true;
 }
 
 /**
  * @brief       Sets the bit field value
  *
- * @param[in]   bitField        Bit field parameters structure
+ * @tparam      F               Bit field descriptor, must be writable
  * @param[in]   bitFNewValue    Value of the bit field
  * @retval      TRUE if success
- * @retval      FALSE if register access denied
  * @pre         None
  */
-bool Reg::setBitField(BitField_t bitField, uint16_t bitFNewValue)
+template <typename F>
+bool Reg::setBitField(uint16_t bitFNewValue)
 {
-	bool err = false;
-
-	if ((REG_ACCESS_W & bitField.regAccess) == REG_ACCESS_W)
-	{
-		Tle5012b *p = static_cast<Tle5012b*>(parent_);
-		regMap[bitField.posMap] = (regMap[bitField.posMap] & ~bitField.mask) | ((bitFNewValue << bitField.position) & bitField.mask);
-		p->writeToSensor(addrFields[bitField.posMap].regAddress, regMap[bitField.posMap], true);
-		err = true;
-	}
-
-	return err;
+	static_assert((F::regAccess & REG_ACCESS_W) == REG_ACCESS_W, "register bit field is not writable");
+	writeRegister(F::posMap, F::mask, (uint16_t)(bitFNewValue << F::position));
+	return true;
 }
 
 /**
@@ -236,7 +174,7 @@ bool Reg::setBitField(BitField_t bitField, uint16_t bitFNewValue)
 bool Reg::isStatusReset(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SRST], bitf);
+	getBitField<REG_STAT_SRST>(bitf);
 	return bitf;
 }
 
@@ -249,7 +187,7 @@ bool Reg::isStatusReset(void)
 bool Reg::isStatusWatchDog(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SWD], bitf);
+	getBitField<REG_STAT_SWD>(bitf);
 	return bitf;
 }
 
@@ -262,7 +200,7 @@ bool Reg::isStatusWatchDog(void)
 bool Reg::isStatusVoltage(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SVR], bitf);
+	getBitField<REG_STAT_SVR>(bitf);
 	return bitf;
 }
 
@@ -275,7 +213,7 @@ bool Reg::isStatusVoltage(void)
 bool Reg::isStatusFuse(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SFUSE], bitf);
+	getBitField<REG_STAT_SFUSE>(bitf);
 	return bitf;
 }
 
@@ -288,7 +226,7 @@ bool Reg::isStatusFuse(void)
 bool Reg::isStatusDSPU(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SDSPU], bitf);
+	getBitField<REG_STAT_SDSPU>(bitf);
 	return bitf;
 }
 
@@ -301,7 +239,7 @@ bool Reg::isStatusDSPU(void)
 bool Reg::isStatusOverflow(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SOV], bitf);
+	getBitField<REG_STAT_SOV>(bitf);
 	return bitf;
 }
 
@@ -314,7 +252,7 @@ bool Reg::isStatusOverflow(void)
 bool Reg::isStatusXYOutOfLimit(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SXYOL], bitf);
+	getBitField<REG_STAT_SXYOL>(bitf);
 	return bitf;
 }
 
@@ -327,7 +265,7 @@ bool Reg::isStatusXYOutOfLimit(void)
 bool Reg::isStatusMagnitideOutOfLimit(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SMAGOL], bitf);
+	getBitField<REG_STAT_SMAGOL>(bitf);
 	return bitf;
 }
 
@@ -340,7 +278,7 @@ bool Reg::isStatusMagnitideOutOfLimit(void)
 bool Reg::isStatusADC(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SADCT], bitf);
+	getBitField<REG_STAT_SADCT>(bitf);
 	return bitf;
 }
 
@@ -353,7 +291,7 @@ bool Reg::isStatusADC(void)
 bool Reg::isStatusROM(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SROM], bitf);
+	getBitField<REG_STAT_SROM>(bitf);
 	return bitf;
 }
 
@@ -366,7 +304,7 @@ bool Reg::isStatusROM(void)
 bool Reg::isStatusGMRXY(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_NOGMRXY], bitf);
+	getBitField<REG_STAT_NOGMRXY>(bitf);
 	return bitf;
 }
 
@@ -379,7 +317,7 @@ bool Reg::isStatusGMRXY(void)
 bool Reg::isStatusGMRA(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_NOGMRA], bitf);
+	getBitField<REG_STAT_NOGMRA>(bitf);
 	return bitf;
 }
 
@@ -392,7 +330,7 @@ bool Reg::isStatusGMRA(void)
 bool Reg::isStatusRead(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_RDST], bitf);
+	getBitField<REG_STAT_RDST>(bitf);
 	return bitf;
 }
 
@@ -404,7 +342,7 @@ bool Reg::isStatusRead(void)
 uint8_t Reg::getSlaveNumber(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_STAT_SNR], bitf);
+	getBitField<REG_STAT_SNR>(bitf);
 	return bitf;
 }
 
@@ -415,7 +353,7 @@ uint8_t Reg::getSlaveNumber(void)
  */
 void Reg::setSlaveNumber(uint8_t snr)
 {
-	setBitField(bitFields[REG_STAT_SNR], snr);
+	setBitField<REG_STAT_SNR>(snr);
 }
 
 /**
@@ -427,7 +365,7 @@ void Reg::setSlaveNumber(uint8_t snr)
 bool Reg::isActivationReset(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASRST], bitf);
+	getBitField<REG_ACSTAT_ASRST>(bitf);
 	return bitf;
 }
 
@@ -437,7 +375,7 @@ bool Reg::isActivationReset(void)
  */
 void Reg::setActivationReset(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASRST], 1);
+	setBitField<REG_ACSTAT_ASRST>(1);
 }
 
 /**
@@ -446,7 +384,7 @@ void Reg::setActivationReset(void)
  */
 void Reg::enableWatchdog(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASWD], 1);
+	setBitField<REG_ACSTAT_ASWD>(1);
 }
 
 /**
@@ -455,7 +393,7 @@ void Reg::enableWatchdog(void)
  */
 void Reg::disableWatchdog(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASWD], 0);
+	setBitField<REG_ACSTAT_ASWD>(0);
 }
 
 /**
@@ -467,7 +405,7 @@ void Reg::disableWatchdog(void)
 bool Reg::isWatchdog(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASWD], bitf);
+	getBitField<REG_ACSTAT_ASWD>(bitf);
 	return bitf;
 }
 
@@ -477,7 +415,7 @@ bool Reg::isWatchdog(void)
  */
 void Reg::enableVoltageCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASVR], 1);
+	setBitField<REG_ACSTAT_ASVR>(1);
 }
 
 /**
@@ -486,7 +424,7 @@ void Reg::enableVoltageCheck(void)
  */
 void Reg::disableVoltageCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASVR], 0);
+	setBitField<REG_ACSTAT_ASVR>(0);
 }
 
 /**
@@ -498,7 +436,7 @@ void Reg::disableVoltageCheck(void)
 bool Reg::isVoltageCheck(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASVR], bitf);
+	getBitField<REG_ACSTAT_ASVR>(bitf);
 	return bitf;
 }
 
@@ -508,7 +446,7 @@ bool Reg::isVoltageCheck(void)
  */
 void Reg::enableFuseCRC(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASFUSE], 1);
+	setBitField<REG_ACSTAT_ASFUSE>(1);
 }
 
 /**
@@ -517,7 +455,7 @@ void Reg::enableFuseCRC(void)
  */
 void Reg::disableFuseCRC(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASFUSE], 0);
+	setBitField<REG_ACSTAT_ASFUSE>(0);
 }
 
 /**
@@ -529,7 +467,7 @@ void Reg::disableFuseCRC(void)
 bool Reg::isFuseCRC(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASFUSE], bitf);
+	getBitField<REG_ACSTAT_ASFUSE>(bitf);
 	return bitf;
 }
 
@@ -539,7 +477,7 @@ bool Reg::isFuseCRC(void)
  */
 void Reg::enableDSPUbist(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASDSPU], 1);
+	setBitField<REG_ACSTAT_ASDSPU>(1);
 }
 
 /**
@@ -548,7 +486,7 @@ void Reg::enableDSPUbist(void)
  */
 void Reg::disableDSPUbist(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASDSPU], 0);
+	setBitField<REG_ACSTAT_ASDSPU>(0);
 }
 
 /**
@@ -560,7 +498,7 @@ void Reg::disableDSPUbist(void)
 bool Reg::isDSPUbist(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASDSPU], bitf);
+	getBitField<REG_ACSTAT_ASDSPU>(bitf);
 	return bitf;
 }
 
@@ -570,7 +508,7 @@ bool Reg::isDSPUbist(void)
  */
 void Reg::enableDSPUoverflow(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASOV], 1);
+	setBitField<REG_ACSTAT_ASOV>(1);
 }
 
 /**
@@ -579,7 +517,7 @@ void Reg::enableDSPUoverflow(void)
  */
 void Reg::disableDSPUoverflow(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASOV], 0);
+	setBitField<REG_ACSTAT_ASOV>(0);
 }
 
 /**
@@ -591,7 +529,7 @@ void Reg::disableDSPUoverflow(void)
 bool Reg::isDSPUoverflow(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASOV], bitf);
+	getBitField<REG_ACSTAT_ASOV>(bitf);
 	return bitf;
 }
 
@@ -601,7 +539,7 @@ bool Reg::isDSPUoverflow(void)
  */
 void Reg::enableXYCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASVECXY], 1);
+	setBitField<REG_ACSTAT_ASVECXY>(1);
 }
 
 /**
@@ -610,7 +548,7 @@ void Reg::enableXYCheck(void)
  */
 void Reg::disableXYCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASVECXY], 0);
+	setBitField<REG_ACSTAT_ASVECXY>(0);
 }
 
 /**
@@ -622,7 +560,7 @@ void Reg::disableXYCheck(void)
 bool Reg::isXYCheck(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASVECXY], bitf);
+	getBitField<REG_ACSTAT_ASVECXY>(bitf);
 	return bitf;
 }
 
@@ -632,7 +570,7 @@ bool Reg::isXYCheck(void)
  */
 void Reg::enableGMRCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASVEGMAG], 1);
+	setBitField<REG_ACSTAT_ASVEGMAG>(1);
 }
 
 /**
@@ -641,7 +579,7 @@ void Reg::enableGMRCheck(void)
  */
 void Reg::disableGMRCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASVEGMAG], 0);
+	setBitField<REG_ACSTAT_ASVEGMAG>(0);
 }
 
 /**
@@ -653,7 +591,7 @@ void Reg::disableGMRCheck(void)
 bool Reg::isGMRCheck(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASVEGMAG], bitf);
+	getBitField<REG_ACSTAT_ASVEGMAG>(bitf);
 	return bitf;
 }
 
@@ -663,7 +601,7 @@ bool Reg::isGMRCheck(void)
  */
 void Reg::enableADCCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASADCT], 1);
+	setBitField<REG_ACSTAT_ASADCT>(1);
 }
 
 /**
@@ -672,7 +610,7 @@ void Reg::enableADCCheck(void)
  */
 void Reg::disableADCCheck(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASADCT], 0);
+	setBitField<REG_ACSTAT_ASADCT>(0);
 }
 
 /**
@@ -684,7 +622,7 @@ void Reg::disableADCCheck(void)
 bool Reg::isADCCheck(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASADCT], bitf);
+	getBitField<REG_ACSTAT_ASADCT>(bitf);
 	return bitf;
 }
 
@@ -695,7 +633,7 @@ bool Reg::isADCCheck(void)
  */
 void Reg::activateFirmwareReset(void)
 {
-	setBitField(bitFields[REG_ACSTAT_ASFRST], 1);
+	setBitField<REG_ACSTAT_ASFRST>(1);
 }
 
 /**
@@ -707,7 +645,7 @@ void Reg::activateFirmwareReset(void)
 bool Reg::isFirmwareReset(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ACSTAT_ASFRST], bitf);
+	getBitField<REG_ACSTAT_ASFRST>(bitf);
 	return bitf;
 }
 
@@ -720,7 +658,7 @@ bool Reg::isFirmwareReset(void)
 bool Reg::isAngleValueNew(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_AVAL_RDAV], bitf);
+	getBitField<REG_AVAL_RDAV>(bitf);
 	return bitf;
 }
 
@@ -732,7 +670,7 @@ bool Reg::isAngleValueNew(void)
 uint16_t Reg::getAngleValue(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_AVAL_ANGVAL], bitf);
+	getBitField<REG_AVAL_ANGVAL>(bitf);
 	return bitf;
 }
 
@@ -745,7 +683,7 @@ uint16_t Reg::getAngleValue(void)
 bool Reg::isSpeedValueNew(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ASPD_RDAS], bitf);
+	getBitField<REG_ASPD_RDAS>(bitf);
 	return bitf;
 }
 
@@ -757,7 +695,7 @@ bool Reg::isSpeedValueNew(void)
 uint16_t Reg::getSpeedValue(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ASPD_ANGSPD], bitf);
+	getBitField<REG_ASPD_ANGSPD>(bitf);
 	return bitf;
 }
 
@@ -770,7 +708,7 @@ uint16_t Reg::getSpeedValue(void)
 bool Reg::isNumberOfRevolutionsNew(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_AREV_RDREV], bitf);
+	getBitField<REG_AREV_RDREV>(bitf);
 	return bitf;
 }
 
@@ -783,11 +721,12 @@ uint16_t Reg::getNumberOfRevolutions(void)
 {
 	uint16_t bitf = 0x00;
 	uint16_t revol = 0x00;
-	getBitField(bitFields[REG_AREV_REVOL], bitf);
-	revol = (bitf & 0xFF);
+	getBitField<REG_AREV_REVOL>(bitf);
+	revol = bitf;
+	// 9 bit two's complement, sign extended to 16 bit
 	if (revol & 0x100)
 	{
-		revol = revol * -1;
+		revol = revol | 0xFE00;
 	}
 	return revol;
 }
@@ -801,7 +740,7 @@ uint16_t Reg::getNumberOfRevolutions(void)
 uint16_t Reg::getFrameCounter(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_AREV_FCNT], bitf);
+	getBitField<REG_AREV_FCNT>(bitf);
 	return bitf;
 }
 
@@ -811,7 +750,7 @@ uint16_t Reg::getFrameCounter(void)
  */
 void Reg::setFrameCounter(uint16_t fcnt)
 {
-	setBitField(bitFields[REG_AREV_FCNT], fcnt);
+	setBitField<REG_AREV_FCNT>(fcnt);
 }
 
 /**
@@ -823,7 +762,7 @@ void Reg::setFrameCounter(uint16_t fcnt)
 uint16_t Reg::getFrameSyncCounter(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_FSYNC_FSYNC], bitf);
+	getBitField<REG_FSYNC_FSYNC>(bitf);
 	//FSYNC = (reg & 0xFE00) >> 9;
 	return bitf;
 }
@@ -831,10 +770,12 @@ uint16_t Reg::getFrameSyncCounter(void)
 /**
  * @brief Set the frame synchronisation counter value
  *
+ * @attention FSYNC is a read only bit field, so this function
+ * never writes to the sensor. It is kept for compatibility only.
  */
 void Reg::setFrameSyncCounter(uint16_t fsync)
 {
-	setBitField(bitFields[REG_FSYNC_FSYNC], fsync);
+	(void)fsync;
 }
 
 /**
@@ -847,12 +788,12 @@ uint16_t Reg::getTemperatureValue(void)
 {
 	uint16_t bitf = 0x00;
 	uint16_t TEMPR = 0x00;
-	getBitField(bitFields[REG_FSYNC_TEMPR], bitf);
-	return bitf;
-	TEMPR = (bitf & 0xFF);
+	getBitField<REG_FSYNC_TEMPR>(bitf);
+	TEMPR = bitf;
+	// 9 bit two's complement, sign extended to 16 bit
 	if (TEMPR & 0x100)
 	{
-		TEMPR = TEMPR * -1;
+		TEMPR = TEMPR | 0xFE00;
 	}
 	return TEMPR;
 }
@@ -863,7 +804,7 @@ uint16_t Reg::getTemperatureValue(void)
  */
 void Reg::setFilterDecimation(uint8_t firmd)
 {
-	setBitField(bitFields[REG_MOD_1_FIRMD], firmd);
+	setBitField<REG_MOD_1_FIRMD>(firmd);
 }
 
 /**
@@ -874,7 +815,7 @@ void Reg::setFilterDecimation(uint8_t firmd)
 uint8_t Reg::getFilterDecimation(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_1_FIRMD], bitf);
+	getBitField<REG_MOD_1_FIRMD>(bitf);
 	return bitf;
 }
 
@@ -884,7 +825,7 @@ uint8_t Reg::getFilterDecimation(void)
  */
 void Reg::setIIFMod(uint8_t iifmod)
 {
-	setBitField(bitFields[REG_MOD_1_IIFMOD], iifmod);
+	setBitField<REG_MOD_1_IIFMOD>(iifmod);
 }
 
 /**
@@ -896,7 +837,7 @@ void Reg::setIIFMod(uint8_t iifmod)
 uint8_t Reg::getIIFMod(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_1_IIFMOD], bitf);
+	getBitField<REG_MOD_1_IIFMOD>(bitf);
 	return bitf;
 }
 
@@ -906,7 +847,7 @@ uint8_t Reg::getIIFMod(void)
  */
 void Reg::holdDSPU(void)
 {
-	setBitField(bitFields[REG_MOD_1_DSPUHOLD], 1);
+	setBitField<REG_MOD_1_DSPUHOLD>(1);
 }
 
 /**
@@ -915,7 +856,7 @@ void Reg::holdDSPU(void)
  */
 void Reg::releaseDSPU(void)
 {
-	setBitField(bitFields[REG_MOD_1_DSPUHOLD], 0);
+	setBitField<REG_MOD_1_DSPUHOLD>(0);
 }
 
 /**
@@ -927,7 +868,7 @@ void Reg::releaseDSPU(void)
 bool Reg::isDSPUhold(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_1_DSPUHOLD], bitf);
+	getBitField<REG_MOD_1_DSPUHOLD>(bitf);
 	return bitf;
 }
 
@@ -937,7 +878,7 @@ bool Reg::isDSPUhold(void)
  */
 void Reg::setInternalClock(void)
 {
-	setBitField(bitFields[REG_MOD_1_CLKSEL], 0);
+	setBitField<REG_MOD_1_CLKSEL>(0);
 }
 
 /**
@@ -946,7 +887,7 @@ void Reg::setInternalClock(void)
  */
 void Reg::setExternalClock(void)
 {
-	setBitField(bitFields[REG_MOD_1_CLKSEL], 1);
+	setBitField<REG_MOD_1_CLKSEL>(1);
 }
 
 /**
@@ -958,7 +899,7 @@ void Reg::setExternalClock(void)
 bool Reg::statusClockSource(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_1_CLKSEL], bitf);
+	getBitField<REG_MOD_1_CLKSEL>(bitf);
 	return bitf;
 }
 
@@ -968,7 +909,7 @@ bool Reg::statusClockSource(void)
  */
 void Reg::enableFilterParallel(void)
 {
-	setBitField(bitFields[REG_SIL_FILTPAR], 1);
+	setBitField<REG_SIL_FILTPAR>(1);
 }
 
 /**
@@ -977,7 +918,7 @@ void Reg::enableFilterParallel(void)
  */
 void Reg::disableFilterParallel(void)
 {
-	setBitField(bitFields[REG_SIL_FILTPAR], 0);
+	setBitField<REG_SIL_FILTPAR>(0);
 }
 
 /**
@@ -989,7 +930,7 @@ void Reg::disableFilterParallel(void)
 bool Reg::isFilterParallel(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SIL_FILTPAR], bitf);
+	getBitField<REG_SIL_FILTPAR>(bitf);
 	return bitf;
 }
 
@@ -999,7 +940,7 @@ bool Reg::isFilterParallel(void)
  */
 void Reg::enableFilterInverted(void)
 {
-	setBitField(bitFields[REG_SIL_FILTINV], 1);
+	setBitField<REG_SIL_FILTINV>(1);
 }
 
 /**
@@ -1008,7 +949,7 @@ void Reg::enableFilterInverted(void)
  */
 void Reg::disableFilterInverted(void)
 {
-	setBitField(bitFields[REG_SIL_FILTINV], 0);
+	setBitField<REG_SIL_FILTINV>(0);
 }
 
 /**
@@ -1020,7 +961,7 @@ void Reg::disableFilterInverted(void)
 bool Reg::isFilterInverted(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SIL_FILTINV], bitf);
+	getBitField<REG_SIL_FILTINV>(bitf);
 	return bitf;
 }
 
@@ -1030,7 +971,7 @@ bool Reg::isFilterInverted(void)
  */
 void Reg::enableADCTestVector(void)
 {
-	setBitField(bitFields[REG_SIL_ADCTVEN], 1);
+	setBitField<REG_SIL_ADCTVEN>(1);
 }
 
 /**
@@ -1039,7 +980,7 @@ void Reg::enableADCTestVector(void)
  */
 void Reg::disableADCTestVector(void)
 {
-	setBitField(bitFields[REG_SIL_ADCTVEN], 0);
+	setBitField<REG_SIL_ADCTVEN>(0);
 }
 
 /**
@@ -1051,7 +992,7 @@ void Reg::disableADCTestVector(void)
 bool Reg::isADCTestVector(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SIL_ADCTVEN], bitf);
+	getBitField<REG_SIL_ADCTVEN>(bitf);
 	return bitf;
 }
 
@@ -1061,7 +1002,7 @@ bool Reg::isADCTestVector(void)
  */
 void Reg::setFuseReload(void)
 {
-	setBitField(bitFields[REG_SIL_FUSEREL], 1);
+	setBitField<REG_SIL_FUSEREL>(1);
 }
 
 /**
@@ -1073,7 +1014,7 @@ void Reg::setFuseReload(void)
 bool Reg::getFulseReload(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SIL_FUSEREL], bitf);
+	getBitField<REG_SIL_FUSEREL>(bitf);
 	return bitf;
 }
 
@@ -1083,7 +1024,7 @@ bool Reg::getFulseReload(void)
  */
 void Reg::setTestVectorX(uint8_t adctvx)
 {
-	setBitField(bitFields[REG_SIL_ADCTVX], adctvx);
+	setBitField<REG_SIL_ADCTVX>(adctvx);
 }
 
 /**
@@ -1094,7 +1035,7 @@ void Reg::setTestVectorX(uint8_t adctvx)
 uint8_t Reg::getTestVectorX(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SIL_ADCTVX], bitf);
+	getBitField<REG_SIL_ADCTVX>(bitf);
 	return bitf;
 }
 
@@ -1104,7 +1045,7 @@ uint8_t Reg::getTestVectorX(void)
  */
 void Reg::setTestVectorY(uint8_t adctvs)
 {
-	setBitField(bitFields[REG_SIL_ADCTVY], adctvs);
+	setBitField<REG_SIL_ADCTVY>(adctvs);
 }
 
 /**
@@ -1115,7 +1056,7 @@ void Reg::setTestVectorY(uint8_t adctvs)
 uint8_t Reg::getTestVectorY(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SIL_ADCTVY], bitf);
+	getBitField<REG_SIL_ADCTVY>(bitf);
 	return bitf;
 }
 
@@ -1125,7 +1066,7 @@ uint8_t Reg::getTestVectorY(void)
  */
 void Reg::directionClockwise(void)
 {
-	setBitField(bitFields[REG_MOD_2_ANGDIR], 1);
+	setBitField<REG_MOD_2_ANGDIR>(1);
 }
 
 /**
@@ -1134,7 +1075,7 @@ void Reg::directionClockwise(void)
  */
 void Reg::directionConterClockwise(void)
 {
-	setBitField(bitFields[REG_MOD_2_ANGDIR], 0);
+	setBitField<REG_MOD_2_ANGDIR>(0);
 }
 
 /**
@@ -1146,7 +1087,7 @@ void Reg::directionConterClockwise(void)
 bool Reg::isAngleDirection(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_2_ANGDIR], bitf);
+	getBitField<REG_MOD_2_ANGDIR>(bitf);
 	return bitf;
 }
 
@@ -1156,7 +1097,7 @@ bool Reg::isAngleDirection(void)
  */
 void Reg::enablePrediction(void)
 {
-	setBitField(bitFields[REG_MOD_2_PREDICT], 1);
+	setBitField<REG_MOD_2_PREDICT>(1);
 }
 
 /**
@@ -1165,7 +1106,7 @@ void Reg::enablePrediction(void)
  */
 void Reg::disablePrediction(void)
 {
-	setBitField(bitFields[REG_MOD_2_PREDICT], 0);
+	setBitField<REG_MOD_2_PREDICT>(0);
 }
 
 /**
@@ -1177,7 +1118,7 @@ void Reg::disablePrediction(void)
 bool Reg::isPrediction(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_2_PREDICT], bitf);
+	getBitField<REG_MOD_2_PREDICT>(bitf);
 	return bitf;
 }
 
@@ -1187,7 +1128,7 @@ bool Reg::isPrediction(void)
  */
 void Reg::setAngleRange(angleRange_t range)
 {
-	setBitField(bitFields[REG_MOD_2_ANGRANGE], range);
+	setBitField<REG_MOD_2_ANGRANGE>(range);
 }
 
 /**
@@ -1198,7 +1139,7 @@ void Reg::setAngleRange(angleRange_t range)
 Reg::angleRange_t Reg::getAngleRange(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_2_ANGRANGE], bitf);
+	getBitField<REG_MOD_2_ANGRANGE>(bitf);
 	return (angleRange_t)bitf;
 }
 
@@ -1208,7 +1149,7 @@ Reg::angleRange_t Reg::getAngleRange(void)
  */
 void Reg::setCalibrationMode(calibrationMode_t autocal)
 {
-	setBitField(bitFields[REG_MOD_2_AUTOCAL], autocal);
+	setBitField<REG_MOD_2_AUTOCAL>(autocal);
 }
 
 /**
@@ -1219,7 +1160,7 @@ void Reg::setCalibrationMode(calibrationMode_t autocal)
 Reg::calibrationMode_t Reg::getCalibrationMode(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_2_AUTOCAL], bitf);
+	getBitField<REG_MOD_2_AUTOCAL>(bitf);
 	return (calibrationMode_t)bitf;
 }
 
@@ -1229,7 +1170,7 @@ Reg::calibrationMode_t Reg::getCalibrationMode(void)
  */
 void Reg::enableSpikeFilter(void)
 {
-	setBitField(bitFields[REG_MOD_3_SPIKEF], 1);
+	setBitField<REG_MOD_3_SPIKEF>(1);
 }
 
 /**
@@ -1238,7 +1179,7 @@ void Reg::enableSpikeFilter(void)
  */
 void Reg::disableSpikeFilter(void)
 {
-	setBitField(bitFields[REG_MOD_3_SPIKEF], 0);
+	setBitField<REG_MOD_3_SPIKEF>(0);
 }
 
 /**
@@ -1250,7 +1191,7 @@ void Reg::disableSpikeFilter(void)
 bool Reg::isSpikeFilter(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_3_SPIKEF], bitf);
+	getBitField<REG_MOD_3_SPIKEF>(bitf);
 	return bitf;
 }
 
@@ -1260,7 +1201,7 @@ bool Reg::isSpikeFilter(void)
  */
 void Reg::enableSSCOpenDrain(void)
 {
-	setBitField(bitFields[REG_MOD_3_SSCOD], 1);
+	setBitField<REG_MOD_3_SSCOD>(1);
 }
 
 /**
@@ -1269,7 +1210,7 @@ void Reg::enableSSCOpenDrain(void)
  */
 void Reg::enableSSCPushPull(void)
 {
-	setBitField(bitFields[REG_MOD_3_SSCOD], 0);
+	setBitField<REG_MOD_3_SSCOD>(0);
 }
 
 /**
@@ -1281,7 +1222,7 @@ void Reg::enableSSCPushPull(void)
 bool Reg::isSSCOutputMode(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_3_SSCOD], bitf);
+	getBitField<REG_MOD_3_SSCOD>(bitf);
 	return bitf;
 }
 
@@ -1291,7 +1232,7 @@ bool Reg::isSSCOutputMode(void)
  */
 void Reg::setAngleBase(uint16_t base)
 {
-	setBitField(bitFields[REG_MOD_3_ANG_BASE], base);
+	setBitField<REG_MOD_3_ANG_BASE>(base);
 }
 
 /**
@@ -1303,7 +1244,7 @@ void Reg::setAngleBase(uint16_t base)
 uint16_t Reg::getAngleBase(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_3_ANG_BASE], bitf);
+	getBitField<REG_MOD_3_ANG_BASE>(bitf);
 	return bitf;
 }
 
@@ -1313,7 +1254,7 @@ uint16_t Reg::getAngleBase(void)
  */
 void Reg::setPadDriver(uint8_t pad)
 {
-	setBitField(bitFields[REG_MOD_3_PADDRV], pad);
+	setBitField<REG_MOD_3_PADDRV>(pad);
 }
 
 /**
@@ -1324,7 +1265,7 @@ void Reg::setPadDriver(uint8_t pad)
 uint8_t Reg::getPadDriver(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_3_PADDRV], bitf);
+	getBitField<REG_MOD_3_PADDRV>(bitf);
 	return bitf;
 }
 
@@ -1334,7 +1275,7 @@ uint8_t Reg::getPadDriver(void)
  */
 void Reg::setOffsetX(int16_t offx)
 {
-	setBitField(bitFields[REG_OFFX_XOFFSET], offx);
+	setBitField<REG_OFFX_XOFFSET>(offx);
 }
 
 /**
@@ -1345,7 +1286,7 @@ void Reg::setOffsetX(int16_t offx)
 int16_t Reg::getOffsetX(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_OFFX_XOFFSET], bitf);
+	getBitField<REG_OFFX_XOFFSET>(bitf);
 	return (int16_t)bitf;
 }
 
@@ -1355,7 +1296,7 @@ int16_t Reg::getOffsetX(void)
  */
 void Reg::setOffsetY(int16_t offy)
 {
-	setBitField(bitFields[REG_OFFY_YOFFSET], offy);
+	setBitField<REG_OFFY_YOFFSET>(offy);
 }
 
 /**
@@ -1366,7 +1307,7 @@ void Reg::setOffsetY(int16_t offy)
 int16_t Reg::getOffsetY(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_OFFY_YOFFSET], bitf);
+	getBitField<REG_OFFY_YOFFSET>(bitf);
 	return (int16_t)bitf;
 }
 
@@ -1376,7 +1317,7 @@ int16_t Reg::getOffsetY(void)
  */
 void Reg::setAmplitudeSynch(int16_t synch)
 {
-	setBitField(bitFields[REG_SYNCH_SYNCH], synch);
+	setBitField<REG_SYNCH_SYNCH>(synch);
 }
 
 /**
@@ -1387,7 +1328,7 @@ void Reg::setAmplitudeSynch(int16_t synch)
 int16_t Reg::getAmplitudeSynch(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_SYNCH_SYNCH], bitf);
+	getBitField<REG_SYNCH_SYNCH>(bitf);
 	return (int16_t)bitf;
 }
 
@@ -1397,7 +1338,7 @@ int16_t Reg::getAmplitudeSynch(void)
  */
 void Reg::setFIRUpdateRate(bool fir)
 {
-	setBitField(bitFields[REG_IFAB_FIRUDR], fir);
+	setBitField<REG_IFAB_FIRUDR>(fir);
 }
 
 /**
@@ -1408,7 +1349,7 @@ void Reg::setFIRUpdateRate(bool fir)
 uint8_t Reg::getFIRUpdateRate(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_IFAB_FIRUDR], bitf);
+	getBitField<REG_IFAB_FIRUDR>(bitf);
 	return bitf;
 }
 
@@ -1418,7 +1359,7 @@ uint8_t Reg::getFIRUpdateRate(void)
  */
 void Reg::enableIFABOpenDrain(void)
 {
-	setBitField(bitFields[REG_IFAB_IFABOD], 1);
+	setBitField<REG_IFAB_IFABOD>(1);
 }
 
 /**
@@ -1427,7 +1368,7 @@ void Reg::enableIFABOpenDrain(void)
  */
 void Reg::enableIFABPushPull(void)
 {
-	setBitField(bitFields[REG_IFAB_IFABOD], 0);
+	setBitField<REG_IFAB_IFABOD>(0);
 }
 
 /**
@@ -1439,7 +1380,7 @@ void Reg::enableIFABPushPull(void)
 bool Reg::isIFABOutputMode(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_IFAB_IFABOD], bitf);
+	getBitField<REG_IFAB_IFABOD>(bitf);
 	return bitf;
 }
 
@@ -1449,7 +1390,7 @@ bool Reg::isIFABOutputMode(void)
  */
 void Reg::setOrthogonality(int16_t ortho)
 {
-	setBitField(bitFields[REG_IFAB_ORTHO], ortho);
+	setBitField<REG_IFAB_ORTHO>(ortho);
 }
 
 /**
@@ -1460,7 +1401,7 @@ void Reg::setOrthogonality(int16_t ortho)
 int16_t Reg::getOrthogonality(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_IFAB_ORTHO], bitf);
+	getBitField<REG_IFAB_ORTHO>(bitf);
 	return (int16_t)bitf;
 }
 
@@ -1471,7 +1412,7 @@ int16_t Reg::getOrthogonality(void)
  */
 void Reg::setHysteresisMode(uint8_t hyst)
 {
-	setBitField(bitFields[REG_IFAB_IFADHYST], hyst);
+	setBitField<REG_IFAB_IFADHYST>(hyst);
 }
 
 /**
@@ -1483,7 +1424,7 @@ void Reg::setHysteresisMode(uint8_t hyst)
 uint8_t Reg::getHysteresisMode(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_IFAB_IFADHYST], bitf);
+	getBitField<REG_IFAB_IFADHYST>(bitf);
 	return bitf;
 }
 
@@ -1493,7 +1434,7 @@ uint8_t Reg::getHysteresisMode(void)
  */
 void Reg::setInterfaceMode(interfaceType_t ifmd)
 {
-	setBitField(bitFields[REG_MOD_4_IFMD], ifmd);
+	setBitField<REG_MOD_4_IFMD>(ifmd);
 }
 
 /**
@@ -1504,7 +1445,7 @@ void Reg::setInterfaceMode(interfaceType_t ifmd)
 Reg::interfaceType_t Reg::getInterfaceMode(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_4_IFMD], bitf);
+	getBitField<REG_MOD_4_IFMD>(bitf);
 	return (interfaceType_t)bitf;
 }
 
@@ -1514,7 +1455,7 @@ Reg::interfaceType_t Reg::getInterfaceMode(void)
  */
 void Reg::setIFABres(uint8_t res)
 {
-	setBitField(bitFields[REG_MOD_4_IFABRES], res);
+	setBitField<REG_MOD_4_IFABRES>(res);
 }
 
 /**
@@ -1525,7 +1466,7 @@ void Reg::setIFABres(uint8_t res)
 uint8_t Reg::getIFABres(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_4_HSMPLP], bitf);
+	getBitField<REG_MOD_4_IFABRES>(bitf);
 	return bitf;
 }
 
@@ -1535,18 +1476,18 @@ uint8_t Reg::getIFABres(void)
  */
 void Reg::setHSMplp(uint8_t plp)
 {
-	setBitField(bitFields[REG_MOD_4_HSMPLP], plp);
+	setBitField<REG_MOD_4_HSMPLP>(plp);
 }
 
 /**
  * @brief Get multipurpose register
  *
- * @return uint8_t multipurpose, PWM frequency, IIF resolution, SPC frame configuration
+ * @return uint8_t multipurpose, HSM pole pairs, PWM error indication, SPC total trigger time
  */
 uint8_t Reg::getHSMplp(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_4_IFABRES], bitf);
+	getBitField<REG_MOD_4_HSMPLP>(bitf);
 	return bitf;
 }
 
@@ -1556,7 +1497,7 @@ uint8_t Reg::getHSMplp(void)
  */
 void Reg::setOffsetTemperatureX(int8_t tcox)
 {
-	setBitField(bitFields[REG_MOD_4_TCOXT], tcox);
+	setBitField<REG_MOD_4_TCOXT>(tcox);
 }
 
 /**
@@ -1567,10 +1508,11 @@ void Reg::setOffsetTemperatureX(int8_t tcox)
 int8_t Reg::getOffsetTemperatureX(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_MOD_4_TCOXT], bitf);
-	if (bitf & 0x8000)
+	getBitField<REG_MOD_4_TCOXT>(bitf);
+	// 7 bit two's complement
+	if (bitf & 0x40)
 	{
-		bitf = bitf * -1;
+		bitf = bitf - 0x80;
 	}
 	return (int8_t)bitf;
 }
@@ -1581,7 +1523,7 @@ int8_t Reg::getOffsetTemperatureX(void)
  */
 void Reg::setOffsetTemperatureY(int8_t tcoy)
 {
-	setBitField(bitFields[REG_TCO_Y_TCOYT], tcoy);
+	setBitField<REG_TCO_Y_TCOYT>(tcoy);
 }
 
 /**
@@ -1592,10 +1534,11 @@ void Reg::setOffsetTemperatureY(int8_t tcoy)
 int8_t Reg::getOffsetTemperatureY(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_TCO_Y_TCOYT], bitf);
-	if (bitf & 0x8000)
+	getBitField<REG_TCO_Y_TCOYT>(bitf);
+	// 7 bit two's complement
+	if (bitf & 0x40)
 	{
-		bitf = bitf * -1;
+		bitf = bitf - 0x80;
 	}
 	return (int8_t)bitf;
 }
@@ -1606,7 +1549,7 @@ int8_t Reg::getOffsetTemperatureY(void)
  */
 void Reg::enableStartupBist(void)
 {
-	setBitField(bitFields[REG_TCO_Y_SBIST], 1);
+	setBitField<REG_TCO_Y_SBIST>(1);
 }
 
 /**
@@ -1615,7 +1558,7 @@ void Reg::enableStartupBist(void)
  */
 void Reg::disableStartupBist(void)
 {
-	setBitField(bitFields[REG_TCO_Y_SBIST], 0);
+	setBitField<REG_TCO_Y_SBIST>(0);
 }
 
 /**
@@ -1627,7 +1570,7 @@ void Reg::disableStartupBist(void)
 bool Reg::isStartupBist(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_TCO_Y_SBIST], bitf);
+	getBitField<REG_TCO_Y_SBIST>(bitf);
 	return bitf;
 }
 
@@ -1637,7 +1580,7 @@ bool Reg::isStartupBist(void)
  */
 void Reg::setCRCpar(uint16_t crc)
 {
-	setBitField(bitFields[REG_TCO_Y_CRCPAR], crc);
+	setBitField<REG_TCO_Y_CRCPAR>(crc);
 }
 
 /**
@@ -1648,7 +1591,7 @@ void Reg::setCRCpar(uint16_t crc)
 uint16_t Reg::getCRCpar(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_TCO_Y_CRCPAR], bitf);
+	getBitField<REG_TCO_Y_CRCPAR>(bitf);
 	return bitf;
 }
 
@@ -1660,7 +1603,7 @@ uint16_t Reg::getCRCpar(void)
 int16_t Reg::getADCx(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ADC_X_ADCX], bitf);
+	getBitField<REG_ADC_X_ADCX>(bitf);
 	return (int16_t)bitf;
 }
 
@@ -1672,7 +1615,7 @@ int16_t Reg::getADCx(void)
 int16_t Reg::getADCy(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_ADC_Y_ADCY], bitf);
+	getBitField<REG_ADC_Y_ADCY>(bitf);
 	return (int16_t)bitf;
 }
 
@@ -1684,7 +1627,7 @@ int16_t Reg::getADCy(void)
 uint16_t Reg::getVectorMagnitude(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_D_MAG_MAG], bitf);
+	getBitField<REG_D_MAG_MAG>(bitf);
 	return bitf;
 }
 
@@ -1696,7 +1639,7 @@ uint16_t Reg::getVectorMagnitude(void)
 uint16_t Reg::getTemperatureRAW(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_T_RAW_TRAW], bitf);
+	getBitField<REG_T_RAW_TRAW>(bitf);
 	return bitf;
 }
 
@@ -1709,7 +1652,7 @@ uint16_t Reg::getTemperatureRAW(void)
 bool Reg::isTemperatureToggle(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_T_RAW_TTGL], bitf);
+	getBitField<REG_T_RAW_TTGL>(bitf);
 	return bitf;
 }
 
@@ -1721,7 +1664,7 @@ bool Reg::isTemperatureToggle(void)
 uint16_t Reg::getCounterIncrements(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_IIF_CNT_IIFCNT], bitf);
+	getBitField<REG_IIF_CNT_IIFCNT>(bitf);
 	return bitf;
 }
 
@@ -1733,6 +1676,6 @@ uint16_t Reg::getCounterIncrements(void)
 uint16_t Reg::getT25Offset(void)
 {
 	uint16_t bitf = 0x00;
-	getBitField(bitFields[REG_T25O_T250], bitf);
+	getBitField<REG_T25O_T250>(bitf);
 	return bitf;
 }
@@ -80,6 +80,31 @@ class Reg
 			TLE5012B_E9000,       //!< TLE5012B_E9000 Sensor2Go variant
 		};
 
+		/**
+		 * @brief Signature of a sensor variant, the fuse preset interface mode
+		 * and the IFAB bits which separate variants with the same interface
+		 */
+		typedef struct
+		{
+			sensorType_t    type;           //!< \brief sensor variant */
+			interfaceType_t iface;          //!< \brief IFMD of MOD_4 */
+			uint16_t        ifabMask;       //!< \brief IFAB bits which are compared */
+			uint16_t        ifabValue;      //!< \brief IFAB value of these bits */
+		}Signature_t;
+
+		static const Signature_t signatures[];    //!< \brief variant signatures, the first match wins
+		static const uint8_t numSignatures;       //!< \brief number of variant signatures
+
+		/**
+		 * @brief Identifies the sensor variant from MOD_4 and IFAB
+		 *
+		 * @param mod4  MOD_4 register value
+		 * @param ifab  IFAB register value
+		 * @param type  identified sensor variant
+		 * @return true if a signature matches
+		 */
+		static bool identify(uint16_t mod4, uint16_t ifab, sensorType_t &type);
+
 		/**
 		 * \brief Register access type
 		 */
@@ -95,17 +120,38 @@ class Reg
 		};
 
 		/**
-		 * \brief Bit field parameters
+		 * \brief Bit field descriptor
+		 *
+		 * Each register bit field is its own type with the access rights, register
+		 * address, mask, position and regMap index as compile time constants.
+		 * Extracting or inserting a field therefore folds into a mask and shift and
+		 * an access which the field does not allow is rejected by the compiler.
 		 */
-		typedef struct
+		template <uint8_t ACCESS, uint16_t ADDRESS, uint16_t MASK, uint8_t POSITION, uint8_t POSMAP>
+		struct BitField
 		{
-			uint8_t  regAccess;              //!< \brief Bitfield register access */
-			uint16_t regAddress;             //!< \brief Bitfiled register address */
-			uint16_t mask;                   //!< \brief Bitfield mask */
-			uint8_t  position;               //!< \brief Bitfiled position */
-			uint8_t  resetValue;             //!< \brief Bitfield register reset value */
-			uint8_t  posMap;                 //!< \brief Bitfield position of register in regMap */
-		}BitField_t;
+			static const uint8_t  regAccess  = ACCESS;      //!< \brief Bitfield register access */
+			static const uint16_t regAddress = ADDRESS;     //!< \brief Bitfield register address */
+			static const uint16_t mask       = MASK;        //!< \brief Bitfield mask */
+			static const uint8_t  position   = POSITION;    //!< \brief Bitfield position */
+			static const uint8_t  posMap     = POSMAP;      //!< \brief Bitfield position of register in regMap */
+
+			static_assert(MASK != 0, "register bit field has no bits");
+			static_assert(((MASK >> POSITION) << POSITION) == MASK, "register bit field mask has bits below its position");
+			static_assert(((MASK >> POSITION) & 0x1U) == 0x1U, "register bit field position is not the lowest bit of its mask");
+
+			//!< \brief returns the field value from a complete register word
+			static inline uint16_t extract(uint16_t regValue)
+			{
+				return ((regValue & MASK) >> POSITION);
+			}
+
+			//!< \brief returns the register word with the field replaced by value
+			static inline uint16_t insert(uint16_t regValue, uint16_t value)
+			{
+				return ((regValue & ~MASK) | ((value << POSITION) & MASK));
+			}
+		};
 
 		/**
 		 * @brief Register address field
@@ -149,6 +195,119 @@ class Reg
 			REG_T25O         = (0x0300U)     //!< \brief T25O temperature 25°c offset value
 		};
 
+		/**
+		 * \brief Bit fields of all sensor registers
+		 */
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x1,    0,   0> REG_STAT_SRST;          //!< \brief bits 0:0 SRST status reset
+		typedef BitField<REG_ACCESS_R,   REG_STAT,    0x2,    1,   0> REG_STAT_SWD;           //!< \brief bits 1:1 SWD status watch dog
+		typedef BitField<REG_ACCESS_R,   REG_STAT,    0x4,    2,   0> REG_STAT_SVR;           //!< \brief bits 2:2 SVR status voltage regulator
+		typedef BitField<REG_ACCESS_R,   REG_STAT,    0x8,    3,   0> REG_STAT_SFUSE;         //!< \brief bits 3:3 SFUSE status fuses
+		typedef BitField<REG_ACCESS_R,   REG_STAT,    0x10,   4,   0> REG_STAT_SDSPU;         //!< \brief bits 4:4 SDSPU status digital signal processing unit
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x20,   5,   0> REG_STAT_SOV;           //!< \brief bits 5:5 SOV status overflow
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x40,   6,   0> REG_STAT_SXYOL;         //!< \brief bits 6:6 SXYOL status X/Y data out limit
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x80,   7,   0> REG_STAT_SMAGOL;        //!< \brief bits 7:7 SMAGOL status magnitude out limit
+		typedef BitField<REG_ACCESS_RES, REG_STAT,    0x100,  8,   0> REG_STAT_RESERVED;      //!< \brief bits 8:8 reserved
+		typedef BitField<REG_ACCESS_R,   REG_STAT,    0x200,  9,   0> REG_STAT_SADCT;         //!< \brief bits 9:9 SADCT status ADC test
+		typedef BitField<REG_ACCESS_R,   REG_STAT,    0x400,  10,  0> REG_STAT_SROM;          //!< \brief bits 10:10 SROM status ROM
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x800,  11,  0> REG_STAT_NOGMRXY;       //!< \brief bits 11:11 NOGMRXY no valid GMR XY Values
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x1000, 12,  0> REG_STAT_NOGMRA;        //!< \brief bits 12:12 NOGMRA no valid GMR Angle Value
+		typedef BitField<REG_ACCESS_RW,  REG_STAT,    0x6000, 13,  0> REG_STAT_SNR;           //!< \brief bits 14:13 SNR slave number
+		typedef BitField<REG_ACCESS_RU,  REG_STAT,    0x8000, 15,  0> REG_STAT_RDST;          //!< \brief bits 15:15 RDST read status
+
+		typedef BitField<REG_ACCESS_RW,  REG_ACSTAT,  0x1,    0,   1> REG_ACSTAT_ASRST;       //!< \brief bits 0:0 ASRST Activation of Hardware Reset
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x2,    1,   1> REG_ACSTAT_ASWD;        //!< \brief bits 1:1 ASWD Enable DSPU Watch dog
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x4,    2,   1> REG_ACSTAT_ASVR;        //!< \brief bits 2:2 ASVR Enable Voltage regulator Check
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x8,    3,   1> REG_ACSTAT_ASFUSE;      //!< \brief bits 3:3 ASFUSE Activation Fuse CRC
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x10,   4,   1> REG_ACSTAT_ASDSPU;      //!< \brief bits 4:4 ASDSPU Activation DSPU BIST
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x20,   5,   1> REG_ACSTAT_ASOV;        //!< \brief bits 5:5 ASOV Enable of DSPU Overflow Check
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x40,   6,   1> REG_ACSTAT_ASVECXY;     //!< \brief bits 6:6 ASVECXY Activation of X,Y Out of Limit-Check
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x80,   7,   1> REG_ACSTAT_ASVEGMAG;    //!< \brief bits 7:7 ASVEGMAG Activation of Magnitude Check
+		typedef BitField<REG_ACCESS_RES, REG_ACSTAT,  0x100,  8,   1> REG_ACSTAT_RESERVED1;   //!< \brief bits 8:8 Reserved
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x200,  9,   1> REG_ACSTAT_ASADCT;      //!< \brief bits 9:9 ASADCT Enable ADC Test vector Check
+		typedef BitField<REG_ACCESS_RWU, REG_ACSTAT,  0x400,  10,  1> REG_ACSTAT_ASFRST;      //!< \brief bits 10:10 ASFRST Activation of Firmware Reset
+		typedef BitField<REG_ACCESS_RES, REG_ACSTAT,  0xF800, 11,  1> REG_ACSTAT_RESERVED2;   //!< \brief bits 15:11 Reserved
+
+		typedef BitField<REG_ACCESS_RU,  REG_AVAL,    0x7FFF, 0,   2> REG_AVAL_ANGVAL;        //!< \brief bits 14:0 ANGVAL Calculated Angle Value (signed 15-bit)
+		typedef BitField<REG_ACCESS_R,   REG_AVAL,    0x8000, 15,  2> REG_AVAL_RDAV;          //!< \brief bits 15:15 RDAV Read Status, Angle Value
+
+		typedef BitField<REG_ACCESS_RU,  REG_ASPD,    0x7FFF, 0,   3> REG_ASPD_ANGSPD;        //!< \brief bits 14:0 ANGSPD Signed value, where the sign bit [14] indicates the direction of the rotation
+		typedef BitField<REG_ACCESS_R,   REG_ASPD,    0x8000, 15,  3> REG_ASPD_RDAS;          //!< \brief bits 15:15 RDAS Read Status, Angle Speed
+
+		typedef BitField<REG_ACCESS_RU,  REG_AREV,    0x1FF,  0,   4> REG_AREV_REVOL;         //!< \brief bits 8:0 REVOL Revolution counter. Increments for every full rotation in counter-clockwise direction
+		typedef BitField<REG_ACCESS_RWU, REG_AREV,    0x7E00, 9,   4> REG_AREV_FCNT;          //!< \brief bits 14:9 FCNT Internal frame counter. Increments every update period
+		typedef BitField<REG_ACCESS_R,   REG_AREV,    0x8000, 15,  4> REG_AREV_RDREV;         //!< \brief its 15:15 RDREV Read Status, Revolution
+
+		typedef BitField<REG_ACCESS_RWU, REG_FSYNC,   0x1FF,  0,   5> REG_FSYNC_TEMPR;        //!< \brief bits 8:0 TEMPR Signed offset compensated temperature value
+		typedef BitField<REG_ACCESS_RU,  REG_FSYNC,   0xFE00, 9,   5> REG_FSYNC_FSYNC;        //!< \brief bits 15:9 FSYNC Frame Synchronization Counter Value
+
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_1,   0x3,    0,   6> REG_MOD_1_IIFMOD;       //!< \brief bits 1:0 IIFMOD Incremental Interface Mode
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_1,   0x4,    2,   6> REG_MOD_1_DSPUHOLD;     //!< \brief bits 2:2 DSPUHOLD if DSPU is on hold, no watch dog reset is performed by DSPU
+		typedef BitField<REG_ACCESS_RES, REG_MOD_1,   0x8,    3,   6> REG_MOD_1_RESERVED1;    //!< \brief bits 3:3 Reserved1
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_1,   0x10,   4,   6> REG_MOD_1_CLKSEL;       //!< \brief bits 4:4 CLKSEL switch to external clock at start-up only
+		typedef BitField<REG_ACCESS_RES, REG_MOD_1,   0x3FE0, 5,   6> REG_MOD_1_RESERVED2;    //!< \brief bits 13:5 Reserved2
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_1,   0xC000, 14,  6> REG_MOD_1_FIRMD;        //!< \brief bits 15:14 FIRMD Update Rate Setting
+
+		typedef BitField<REG_ACCESS_RW,  REG_SIL,     0x7,    0,   7> REG_SIL_ADCTVX;         //!< \brief bits 2:0 ADCTVX Test vector X
+		typedef BitField<REG_ACCESS_RW,  REG_SIL,     0x38,   3,   7> REG_SIL_ADCTVY;         //!< \brief bits 5:3 ADCTVY Test vector Y
+		typedef BitField<REG_ACCESS_RW,  REG_SIL,     0x40,   6,   7> REG_SIL_ADCTVEN;        //!< \brief bits 6:6 ADCTVEN Sensor elements are internally disconnected and test voltages are connected to ADCs
+		typedef BitField<REG_ACCESS_RES, REG_SIL,     0x380,  7,   7> REG_SIL_RESERVED1;      //!< \brief bits 9:7 Reserved1
+		typedef BitField<REG_ACCESS_RW,  REG_SIL,     0x400,  10,  7> REG_SIL_FUSEREL;        //!< \brief bits 10:10 FUSEREL Triggers reload of default values from laser fuses into configuration registers
+		typedef BitField<REG_ACCESS_RES, REG_SIL,     0x3800, 11,  7> REG_SIL_RESERVED2;      //!< \brief bits 13:11 Reserved2
+		typedef BitField<REG_ACCESS_RW,  REG_SIL,     0x4000, 14,  7> REG_SIL_FILTINV;        //!< \brief bits 14:14 FILTINV the X- and Y-signals are inverted. The angle output is then shifted by 180°
+		typedef BitField<REG_ACCESS_RW,  REG_SIL,     0x8000, 15,  7> REG_SIL_FILTPAR;        //!< \brief bits 15:15 FILTPAR the raw X-signal is routed also to the raw Y-signal input of the filter so SIN and COS signal should be identical
+
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_2,   0x3,    0,   8> REG_MOD_2_AUTOCAL;      //!< \brief bits 1:0 AUTOCAL Automatic calibration of offset and amplitude synchronicity for applications with full-turn
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_2,   0x4,    2,   8> REG_MOD_2_PREDICT;      //!< \brief bits 2:2 PREDICT Prediction of angle value based on current angle speed
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_2,   0x8,    3,   8> REG_MOD_2_ANGDIR;       //!< \brief bits 3:3 ANGDIR Inverts angle and angle speed values and revolution counter behavior
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_2,   0x7FF0, 4,   8> REG_MOD_2_ANGRANGE;     //!< \brief bits 14:4 ANGRANGE Changes the representation of the angle output by multiplying the output with a factor ANG_RANGE/128
+		typedef BitField<REG_ACCESS_RES, REG_MOD_2,   0x8000, 15,  8> REG_MOD_2_RESERVED1;    //!< \brief bits 15:15 Reserved1
+
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_3,   0x3,    0,   9> REG_MOD_3_PADDRV;       //!< \brief bits 1:0 PADDRV Configuration of Pad-Driver
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_3,   0x4,    2,   9> REG_MOD_3_SSCOD;        //!< \brief bits 2:2 SSCOD SSC-Interface Data Pin Output Mode
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_3,   0x8,    3,   9> REG_MOD_3_SPIKEF;       //!< \brief bits 3:3 SPIKEF Filters voltage spikes on input pads (IFC, SCK and CSQ)
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_3,   0xFFF0, 4,   9> REG_MOD_3_ANG_BASE;     //!< \brief bits 15:4 ANG_BASE Sets the 0° angle position (12 bit value). Angle base is factory-calibrated to make the 0° direction parallel to the edge of the chip
+
+		typedef BitField<REG_ACCESS_RES, REG_OFFX,    0xF,    0,  10> REG_OFFX_RESERVED1;     //!< \brief bits 3:0 Reserved1
+		typedef BitField<REG_ACCESS_RW,  REG_OFFX,    0xFFF0, 4,  10> REG_OFFX_XOFFSET;       //!< \brief bits 15:4 XOFFSET 12-bit signed integer value of raw X-signal offset correction at 25°C
+
+		typedef BitField<REG_ACCESS_RES, REG_OFFY,    0xF,    0,  11> REG_OFFY_RESERVED1;     //!< \brief bits 3:0 Reserved1
+		typedef BitField<REG_ACCESS_RW,  REG_OFFY,    0xFFF0, 4,  11> REG_OFFY_YOFFSET;       //!< \brief bits 15:4 YOFFSET 12-bit signed integer value of raw Y-signal offset correction at 25°C
+
+		typedef BitField<REG_ACCESS_RES, REG_SYNCH,   0xF,    0,  12> REG_SYNCH_RESERVED1;    //!< \brief bits 3:0 Reserved1
+		typedef BitField<REG_ACCESS_RW,  REG_SYNCH,   0xFFF0, 4,  12> REG_SYNCH_SYNCH;        //!< \brief bits 15:4 SYNCH 12-bit signed integer value of amplitude synchronicity
+
+		typedef BitField<REG_ACCESS_RW,  REG_IFAB,    0x3,    0,  13> REG_IFAB_IFADHYST;      //!< \brief bits 1:0 IFADHYST Hysteresis (multi-purpose)
+		typedef BitField<REG_ACCESS_RW,  REG_IFAB,    0x4,    2,  13> REG_IFAB_IFABOD;        //!< \brief bits 2:2 IFABOD IFA,IFB,IFC Output Mode
+		typedef BitField<REG_ACCESS_RW,  REG_IFAB,    0x8,    3,  13> REG_IFAB_FIRUDR;        //!< \brief bits 3:3 FIRUDR Initial filter update rate (FIR)
+		typedef BitField<REG_ACCESS_RW,  REG_IFAB,    0xFFF0, 4,  13> REG_IFAB_ORTHO;         //!< \brief bits 15:4 ORTHO Orthogonality Correction of X and Y Components
+
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_4,   0x3,    0,  14> REG_MOD_4_IFMD;         //!< \brief bits 1:0 IFMD Interface Mode on IFA,IFB,IFC
+		typedef BitField<REG_ACCESS_RES, REG_MOD_4,   0x4,    2,  14> REG_MOD_4_RESERVED1;    //!< \brief bits 2:2 Reserved1
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_4,   0x18,   3,  14> REG_MOD_4_IFABRES;      //!< \brief bits 4:3 IFABRES IIF resolution (multi-purpose)
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_4,   0x1E0,  5,  14> REG_MOD_4_HSMPLP;       //!< \brief bits 8:5 HSMPLP Hall Switch mode (multi-purpose)
+		typedef BitField<REG_ACCESS_RW,  REG_MOD_4,   0xFE00, 9,  14> REG_MOD_4_TCOXT;        //!< \brief bits 15:9 TCOXT 7-bit signed integer value of X-offset temperature coefficient
+
+		typedef BitField<REG_ACCESS_RW,  REG_TCO_Y,   0xFF,   0,  15> REG_TCO_Y_CRCPAR;       //!< \brief bits 7:0 CRCPAR CRC of Parameters
+		typedef BitField<REG_ACCESS_RW,  REG_TCO_Y,   0x100,  8,  15> REG_TCO_Y_SBIST;        //!< \brief bits 8:8 SBIST Startup-BIST
+		typedef BitField<REG_ACCESS_RW,  REG_TCO_Y,   0xFE00, 9,  15> REG_TCO_Y_TCOYT;        //!< \brief bits 15:9 TCOYT 7-bit signed integer value of Y-offset temperature coefficient
+
+		typedef BitField<REG_ACCESS_R,   REG_ADC_X,   0xFFFF, 0,  16> REG_ADC_X_ADCX;         //!< \brief bits 15:0 ADCX ADC value of X-GMR
+
+		typedef BitField<REG_ACCESS_R,   REG_ADC_Y,   0xFFFF, 0,  17> REG_ADC_Y_ADCY;         //!< \brief bits 15:0 ADCY ADC value of Y-GMR
+
+		typedef BitField<REG_ACCESS_RU,  REG_D_MAG,   0x3FF,  0,  18> REG_D_MAG_MAG;          //!< \brief bits 9:0 MAG Unsigned Angle Vector Magnitude after X, Y error compensation (due to temperature)
+		typedef BitField<REG_ACCESS_RES, REG_D_MAG,   0xFC00, 10, 18> REG_D_MAG_RESERVED1;    //!< \brief bits 15:10 Reserved1
+
+		typedef BitField<REG_ACCESS_RU,  REG_T_RAW,   0x3FF,  0,  19> REG_T_RAW_TRAW;         //!< \brief bits 9:0 TRAW Temperature Sensor Raw-Value at ADC without offset
+		typedef BitField<REG_ACCESS_RES, REG_T_RAW,   0x7C00, 10, 19> REG_T_RAW_RESERVED1;    //!< \brief bits 14:10 Reserved1
+		typedef BitField<REG_ACCESS_RU,  REG_T_RAW,   0x8000, 15, 19> REG_T_RAW_TTGL;         //!< \brief bits 15:15 TTGL Temperature Sensor Raw-Value Toggle toggles after every new temperature value
+
+		typedef BitField<REG_ACCESS_RU,  REG_IIF_CNT, 0x7FFF, 0,  20> REG_IIF_CNT_IIFCNT;     //!< \brief bits 14:0 IIFCNT 14 bit counter value of IIF increments
+		typedef BitField<REG_ACCESS_RES, REG_IIF_CNT, 0x8000, 15, 20> REG_IIF_CNT_RESERVED1;  //!< \brief bits 15:15 Reserved1
+
+		typedef BitField<REG_ACCESS_R,   REG_T25O,    0x1FF,  0,  21> REG_T25O_T250;          //!< \brief bits 8:0 T250 Signed offset value at 25°C temperature; 1dig=0.36°C
+		typedef BitField<REG_ACCESS_RES, REG_T25O,    0xFE00, 9,  21> REG_T25O_RESERVED1;     //!< \brief bits 15:9 Reserved1
+
 		uint16_t regMap[MAX_NUM_REG];              //!< Register map */
 
 		Reg(void* p);
@@ -330,126 +489,11 @@ class Reg
 
 	private:
 
-		static const BitField_t     bitFields[];        //!< \brief Registers bitfields
-
-		/**
-		 * \brief Bit fields
-		 */
-		enum BitFieldReg_t
-		{
-			REG_STAT_SRST,
-			REG_STAT_SWD,
-			REG_STAT_SVR,
-			REG_STAT_SFUSE,
-			REG_STAT_SDSPU,
-			REG_STAT_SOV,
-			REG_STAT_SXYOL,
-			REG_STAT_SMAGOL,
-			REG_STAT_RESERVED,
-			REG_STAT_SADCT,
-			REG_STAT_SROM,
-			REG_STAT_NOGMRXY,
-			REG_STAT_NOGMRA,
-			REG_STAT_SNR,
-			REG_STAT_RDST,
-
-			REG_ACSTAT_ASRST,
-			REG_ACSTAT_ASWD,
-			REG_ACSTAT_ASVR,
-			REG_ACSTAT_ASFUSE,
-			REG_ACSTAT_ASDSPU,
-			REG_ACSTAT_ASOV,
-			REG_ACSTAT_ASVECXY,
-			REG_ACSTAT_ASVEGMAG,
-			REG_ACSTAT_RESERVED1,
-			REG_ACSTAT_ASADCT,
-			REG_ACSTAT_ASFRST,
-			REG_ACSTAT_RESERVED2,
-
-			REG_AVAL_ANGVAL,
-			REG_AVAL_RDAV,
-
-			REG_ASPD_ANGSPD,
-			REG_ASPD_RDAS,
-
-			REG_AREV_REVOL,
-			REG_AREV_FCNT,
-			REG_AREV_RDREV,
-
-			REG_FSYNC_TEMPR,
-			REG_FSYNC_FSYNC,
-
-			REG_MOD_1_IIFMOD,
-			REG_MOD_1_DSPUHOLD,
-			REG_MOD_1_RESERVED1,
-			REG_MOD_1_CLKSEL,
-			REG_MOD_1_RESERVED2,
-			REG_MOD_1_FIRMD,
-
-			REG_SIL_ADCTVX,
-			REG_SIL_ADCTVY,
-			REG_SIL_ADCTVEN,
-			REG_SIL_RESERVED1,
-			REG_SIL_FUSEREL,
-			REG_SIL_RESERVED2,
-			REG_SIL_FILTINV,
-			REG_SIL_FILTPAR,
-
-			REG_MOD_2_AUTOCAL,
-			REG_MOD_2_PREDICT,
-			REG_MOD_2_ANGDIR,
-			REG_MOD_2_ANGRANGE,
-			REG_MOD_2_RESERVED1,
-
-			REG_MOD_3_PADDRV,
-			REG_MOD_3_SSCOD,
-			REG_MOD_3_SPIKEF,
-			REG_MOD_3_ANG_BASE,
-
-			REG_OFFX_RESERVED1,
-			REG_OFFX_XOFFSET,
-
-			REG_OFFY_RESERVED1,
-			REG_OFFY_YOFFSET,
-
-			REG_SYNCH_RESERVED1,
-			REG_SYNCH_SYNCH,
-
-			REG_IFAB_IFADHYST,
-			REG_IFAB_IFABOD,
-			REG_IFAB_FIRUDR,
-			REG_IFAB_ORTHO,
-
-			REG_MOD_4_IFMD,
-			REG_MOD_4_RESERVED1,
-			REG_MOD_4_IFABRES,
-			REG_MOD_4_HSMPLP,
-			REG_MOD_4_TCOXT,
-
-			REG_TCO_Y_CRCPAR,
-			REG_TCO_Y_SBIST,
-			REG_TCO_Y_TCOYT,
-
-			REG_ADC_X_ADCX,
-
-			REG_ADC_Y_ADCY,
-
-			REG_D_MAG_MAG,
-			REG_D_MAG_RESERVED1,
-
-			REG_T_RAW_TRAW,
-			REG_T_RAW_RESERVED1,
-			REG_T_RAW_TTGL,
-
-			REG_IIF_CNT_IIFCNT,
-			REG_IIF_CNT_RESERVED1,
-
-			REG_T25O_T250,
-			REG_T25O_RESERVED1,
-		};
+		template <typename F> bool getBitField (uint16_t & bitFValue);
+		template <typename F> bool setBitField (uint16_t bitFNewValue);
 
-		bool getBitField (BitField_t bitField, uint16_t & bitFValue);
-		bool setBitField (BitField_t bitField, uint16_t bitFNewValue);
+		uint16_t readRegister (uint8_t posMap, bool update);
+		void     writeRegister(uint8_t posMap, uint16_t mask, uint16_t value);
 
 		void* parent_;
 
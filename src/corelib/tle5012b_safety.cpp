@@ -0,0 +1,164 @@
+/*!
+ * \file        tle5012b_safety.cpp
+ * \name        tle5012b_safety.cpp - safety word policy for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "TLE5012b.hpp"
+
+SafetyPolicy::SafetyPolicy():
+	timer_(NULL),
+	period_(0),
+	lastAudit_(0),
+	statsStart_(0),
+	interval_(1),
+	sinceAudit_(0),
+	recovery_(1),
+	cleanAudits_(0),
+	escalated_(false)
+{
+	stats_.frames = 0;
+	stats_.checkedFrames = 0;
+	stats_.errors = 0;
+	stats_.escalations = 0;
+	stats_.elapsed = 0;
+}
+
+void SafetyPolicy::setInterval(uint16_t interval)
+{
+	interval_ = interval;
+	sinceAudit_ = 0;
+}
+
+void SafetyPolicy::setAuditPeriod(Timer *timer, uint32_t period)
+{
+	timer_ = timer;
+	period_ = period;
+	if (timer_ != NULL)
+	{
+		timer_->start();
+	}
+	lastAudit_ = 0;
+	statsStart_ = 0;
+}
+
+void SafetyPolicy::setRecovery(uint16_t cleanAudits)
+{
+	recovery_ = cleanAudits;
+}
+
+uint32_t SafetyPolicy::now()
+{
+	uint32_t elapsed = 0;
+	if (timer_ != NULL)
+	{
+		timer_->elapsed(elapsed);
+	}
+	return (elapsed);
+}
+
+safetyTypes SafetyPolicy::next()
+{
+	if (escalated_)
+	{
+		return (SAFE_high);
+	}
+	if ((interval_ != 0) && (sinceAudit_ + 1 >= interval_))
+	{
+		return (SAFE_high);
+	}
+	if ((timer_ != NULL) && (period_ != 0) && (now() - lastAudit_ >= period_))
+	{
+		return (SAFE_high);
+	}
+	return (SAFE_low);
+}
+
+void SafetyPolicy::record(safetyTypes safe, errorTypes status)
+{
+	stats_.frames++;
+	if (safe == SAFE_high)
+	{
+		stats_.checkedFrames++;
+		sinceAudit_ = 0;
+		if (timer_ != NULL)
+		{
+			lastAudit_ = now();
+		}
+	}else{
+		sinceAudit_++;
+	}
+
+	if (status != NO_ERROR)
+	{
+		stats_.errors++;
+		if (!escalated_)
+		{
+			stats_.escalations++;
+			escalated_ = true;
+		}
+		cleanAudits_ = 0;
+	}else if (escalated_ && (safe == SAFE_high) && (recovery_ != 0))
+	{
+		cleanAudits_++;
+		if (cleanAudits_ >= recovery_)
+		{
+			deescalate();
+		}
+	}
+}
+
+bool SafetyPolicy::isEscalated() const
+{
+	return (escalated_);
+}
+
+void SafetyPolicy::deescalate()
+{
+	escalated_ = false;
+	cleanAudits_ = 0;
+}
+
+const SafetyPolicy::Stats_t &SafetyPolicy::getStats()
+{
+	stats_.elapsed = (timer_ != NULL) ? (now() - statsStart_) : 0;
+	return (stats_);
+}
+
+uint8_t SafetyPolicy::coverage() const
+{
+	if (stats_.frames == 0)
+	{
+		return (100);
+	}
+	return ((uint8_t) (((uint64_t) stats_.checkedFrames * 100) / stats_.frames));
+}
+
+bool SafetyPolicy::frameRate(uint32_t &rate)
+{
+	rate = 0;
+	uint32_t elapsed = getStats().elapsed;
+	if ((timer_ == NULL) || (elapsed == 0))
+	{
+		return (false);
+	}
+	rate = (uint32_t) (((uint64_t) stats_.frames * 1000) / elapsed);
+	return (true);
+}
+
+void SafetyPolicy::clearStats()
+{
+	stats_.frames = 0;
+	stats_.checkedFrames = 0;
+	stats_.errors = 0;
+	stats_.escalations = 0;
+	stats_.elapsed = 0;
+	statsStart_ = now();
+}
@@ -0,0 +1,129 @@
+/*!
+ * \file        tle5012b_safety.hpp
+ * \name        tle5012b_safety.hpp - safety word policy for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The policy decides for each convenience read if a safety word is
+ *              requested (SAFE_high) or not (SAFE_low). Safety checked audit frames
+ *              are interleaved every N frames and/or after a time budget. After any
+ *              error the policy escalates to always safe until enough clean audits
+ *              have passed. The default setting checks every frame, which is the
+ *              behavior of the library without the policy.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_SAFETY_HPP
+#define TLE5012B_SAFETY_HPP
+
+#include "../pal/timer.hpp"
+#include "tle5012b_util.hpp"
+
+/**
+ * @addtogroup tle5012api
+ *
+ * @{
+ */
+
+class SafetyPolicy
+{
+	public:
+
+		//!< \brief statistics of the policy since the last clearStats
+		struct Stats_t
+		{
+			uint32_t frames;            //!< \brief number of frames recorded
+			uint32_t checkedFrames;     //!< \brief number of frames with safety word
+			uint32_t errors;            //!< \brief number of frames returning an error
+			uint32_t escalations;       //!< \brief number of escalations to always safe
+			uint32_t elapsed;           //!< \brief time in milliseconds since clearStats, only with timer
+		};
+
+		SafetyPolicy();
+
+		/*!
+		* Sets the audit cadence in frames
+		* @param [in] interval every interval frame is read with safety word,
+		*        1 (default) checks every frame, 0 switches the frame cadence off
+		*/
+		void setInterval(uint16_t interval);
+
+		/*!
+		* Sets a time budget between two audits. The timer is also used
+		* for the frame rate, it must be initialized and is started here.
+		* @param [in] timer running timer or NULL to switch the time budget off
+		* @param [in] period maximum time in milliseconds between two audits, 0 only measures time
+		*/
+		void setAuditPeriod(Timer *timer, uint32_t period);
+
+		/*!
+		* Sets the number of clean audits needed to leave
+		* the always safe mode after an error
+		* @param [in] cleanAudits consecutive error free audits, 0 keeps always safe until deescalate
+		*/
+		void setRecovery(uint16_t cleanAudits);
+
+		/*!
+		* Returns the safety setting for the next frame
+		* @return SAFE_high for an audit frame, SAFE_low otherwise
+		*/
+		safetyTypes next();
+
+		/*!
+		* Records the result of a frame read with the setting from next()
+		* @param [in] safe safety setting used for the frame
+		* @param [in] status error type returned by the read
+		*/
+		void record(safetyTypes safe, errorTypes status);
+
+		//!< \brief true if the policy is in always safe mode after an error
+		bool isEscalated() const;
+
+		//!< \brief leaves the always safe mode
+		void deescalate();
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats();
+
+		/*!
+		* Coverage as the share of frames with safety word
+		* @return coverage in percent, 100 if no frame was recorded
+		*/
+		uint8_t coverage() const;
+
+		/*!
+		* Achieved frame rate, needs a timer set with setAuditPeriod
+		* @param [out] rate frames per second
+		* @return true if a rate is available
+		*/
+		bool frameRate(uint32_t &rate);
+
+		//!< \brief clears the statistics and restarts the time measurement
+		void clearStats();
+
+	private:
+
+		Stats_t  stats_;                //!< \brief collected statistics
+		Timer    *timer_;               //!< \brief optional timer for the time budget and frame rate
+		uint32_t period_;               //!< \brief time budget between audits in milliseconds
+		uint32_t lastAudit_;            //!< \brief timer value of the last audit
+		uint32_t statsStart_;           //!< \brief timer value of clearStats
+		uint16_t interval_;             //!< \brief audit cadence in frames
+		uint16_t sinceAudit_;           //!< \brief frames since the last audit
+		uint16_t recovery_;             //!< \brief clean audits needed to deescalate
+		uint16_t cleanAudits_;          //!< \brief clean audits since the escalation
+		bool     escalated_;            //!< \brief always safe after an error
+
+		uint32_t now();
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_SAFETY_HPP */
@@ -0,0 +1,174 @@
+/*!
+ * \file        tle5012b_sampler.cpp
+ * \name        tle5012b_sampler.cpp - change driven sampling for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_sampler.hpp"
+
+/*!
+ * Converts the 15 bit two's complement value of AVAL/ASPD into int16_t
+ */
+static int16_t toSigned15(uint16_t rawData)
+{
+	rawData = (rawData & (DELETE_BIT_15));
+	if (rawData & CHECK_BIT_14)
+	{
+		rawData = rawData - CHANGE_UINT_TO_INT_15;
+	}
+	return ((int16_t) rawData);
+}
+
+/*!
+ * Converts the 9 bit two's complement value of AREV into int16_t
+ */
+static int16_t toSigned9(uint16_t rawData)
+{
+	rawData = (rawData & (DELETE_7BITS));
+	if (rawData & CHECK_BIT_9)
+	{
+		rawData = rawData - CHANGE_UNIT_TO_INT_9;
+	}
+	return ((int16_t) rawData);
+}
+
+Tle5012bSampler::Tle5012bSampler(Tle5012b &sensor):
+	sensor_(sensor),
+	callback_(NULL),
+	callbackArg_(NULL),
+	deadband_(0),
+	reportedAngle_(0),
+	reported_(false),
+	stale_(0)
+{
+	sample_.rawAngle = 0;
+	sample_.rawSpeed = 0;
+	sample_.revolutions = 0;
+	sample_.angleNew = false;
+	sample_.speedNew = false;
+	sample_.revolutionNew = false;
+}
+
+Tle5012bSampler::~Tle5012bSampler()
+{
+	callback_ = NULL;
+}
+
+void Tle5012bSampler::setDeadband(uint16_t deadband)
+{
+	deadband_ = deadband;
+}
+
+void Tle5012bSampler::setCallback(AngleCallback_t cb, void *arg)
+{
+	callback_ = cb;
+	callbackArg_ = arg;
+}
+
+const Tle5012bSampler::Sample_t &Tle5012bSampler::lastSample() const
+{
+	return (sample_);
+}
+
+uint32_t Tle5012bSampler::staleCount() const
+{
+	return (stale_);
+}
+
+void Tle5012bSampler::reset()
+{
+	reported_ = false;
+	stale_ = 0;
+}
+
+errorTypes Tle5012bSampler::sampleAngle(bool &updated, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData = 0;
+	updated = false;
+	errorTypes status = sensor_.readFromSensor(sensor_.reg.REG_AVAL, rawData, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+	processAngle(rawData);
+	updated = sample_.angleNew;
+	return (status);
+}
+
+errorTypes Tle5012bSampler::sample(bool &updated, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData[3] = {0};
+	updated = false;
+	// AVAL, ASPD and AREV are consecutive registers
+	errorTypes status = sensor_.readMoreRegisters(sensor_.reg.REG_AVAL | 0x3, rawData, upd, safe);
+	if (status != NO_ERROR)
+	{
+		return (status);
+	}
+
+	sample_.speedNew = (Reg::REG_ASPD_RDAS::extract(rawData[1]) != 0);
+	if (sample_.speedNew)
+	{
+		sample_.rawSpeed = toSigned15(rawData[1]);
+	}
+	sample_.revolutionNew = (Reg::REG_AREV_RDREV::extract(rawData[2]) != 0);
+	if (sample_.revolutionNew)
+	{
+		sample_.revolutions = toSigned9(rawData[2]);
+	}
+	processAngle(rawData[0]);
+
+	updated = sample_.angleNew || sample_.speedNew || sample_.revolutionNew;
+	return (status);
+}
+
+/*!
+ * Decodes RDAV and the angle of one AVAL word. Not updated values are
+ * counted and skipped, the callback fires once the distance to the last
+ * reported angle exceeds the deadband. The distance wraps at 360°.
+ */
+void Tle5012bSampler::processAngle(uint16_t aval)
+{
+	sample_.angleNew = (Reg::REG_AVAL_RDAV::extract(aval) != 0);
+	if (!sample_.angleNew)
+	{
+		stale_++;
+		return;
+	}
+	sample_.rawAngle = toSigned15(aval);
+
+	if (callback_ == NULL)
+	{
+		return;
+	}
+	if (reported_)
+	{
+		int32_t delta = (int32_t) sample_.rawAngle - (int32_t) reportedAngle_;
+		if (delta >= (int32_t) (POW_2_15 / 2))
+		{
+			delta -= (int32_t) POW_2_15;
+		}
+		else if (delta < -(int32_t) (POW_2_15 / 2))
+		{
+			delta += (int32_t) POW_2_15;
+		}
+		if (delta < 0)
+		{
+			delta = -delta;
+		}
+		if (delta <= (int32_t) deadband_)
+		{
+			return;
+		}
+	}
+	reportedAngle_ = sample_.rawAngle;
+	reported_ = true;
+	callback_(sample_.rawAngle, callbackArg_);
+}
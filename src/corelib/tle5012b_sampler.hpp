@@ -0,0 +1,116 @@
+/*!
+ * \file        tle5012b_sampler.hpp
+ * \name        tle5012b_sampler.hpp - change driven sampling for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The sampler reads the angle value (and optional speed and revolution)
+ *              registers and decodes the RDAV, RDAS and RDREV read status bits from the
+ *              same words. Values which were not updated since the last readout are
+ *              skipped, and the angle callback only fires if the angle moved beyond
+ *              the configured deadband.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_SAMPLER_HPP
+#define TLE5012B_SAMPLER_HPP
+
+#include "TLE5012b.hpp"
+
+/**
+ * @addtogroup tle5012sampler
+ *
+ * @{
+ */
+
+class Tle5012bSampler
+{
+	public:
+
+		/*!
+		* \brief Callback for an angle change beyond the deadband
+		* @param rawAngle signed 15 bit raw angle value, same unit than getAngleValue rawAnglevalue
+		* @param arg user argument set with setCallback
+		*/
+		typedef void (*AngleCallback_t)(int16_t rawAngle, void *arg);
+
+		//!< \brief last decoded sample values and their read status
+		struct Sample_t
+		{
+			int16_t rawAngle;        //!< \brief signed 15 bit raw angle value
+			int16_t rawSpeed;        //!< \brief signed 15 bit raw angle speed value
+			int16_t revolutions;     //!< \brief signed 9 bit number of revolutions
+			bool    angleNew;        //!< \brief RDAV angle value was updated since the last readout
+			bool    speedNew;        //!< \brief RDAS angle speed value was updated since the last readout
+			bool    revolutionNew;   //!< \brief RDREV revolution value was updated since the last readout
+		};
+
+		Tle5012bSampler(Tle5012b &sensor);
+		~Tle5012bSampler();
+
+		/*!
+		* Sets the angle deadband. The callback fires only if the raw angle
+		* differs more than the deadband from the last reported angle.
+		* @param [in] deadband deadband in raw angle digits (360° = 32768)
+		*/
+		void setDeadband(uint16_t deadband);
+
+		/*!
+		* Sets the callback for angle changes beyond the deadband
+		* @param [in] cb callback function or NULL to switch it off
+		* @param [in] arg user argument handed to the callback
+		*/
+		void setCallback(AngleCallback_t cb, void *arg = NULL);
+
+		/*!
+		* Reads only the AVAL register and decodes RDAV from the same word.
+		* @param [out] updated true if a new angle value was decoded
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes sampleAngle(bool &updated, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Reads AVAL, ASPD and AREV with one burst and decodes
+		* RDAV, RDAS and RDREV from the same words.
+		* @param [out] updated true if any of the three values was updated
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type
+		*/
+		errorTypes sample(bool &updated, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		//!< \brief returns the last decoded sample
+		const Sample_t &lastSample() const;
+
+		//!< \brief returns the number of samples skipped as not updated
+		uint32_t staleCount() const;
+
+		//!< \brief forgets the last reported angle, the next new angle always fires the callback
+		void reset();
+
+	private:
+
+		Tle5012b        &sensor_;          //!< \brief sampled sensor
+		Sample_t        sample_;           //!< \brief last decoded sample
+		AngleCallback_t callback_;         //!< \brief angle change callback
+		void            *callbackArg_;     //!< \brief angle change callback argument
+		uint16_t        deadband_;         //!< \brief angle deadband in raw digits
+		int16_t         reportedAngle_;    //!< \brief last angle handed to the callback
+		bool            reported_;         //!< \brief reportedAngle_ is valid
+		uint32_t        stale_;            //!< \brief number of not updated angle samples
+
+		void processAngle(uint16_t aval);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_SAMPLER_HPP */
@@ -0,0 +1,217 @@
+/*!
+ * \file        tle5012b_shadow.cpp
+ * \name        tle5012b_shadow.cpp - RAM shadow of the TLE5012B configuration registers.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_shadow.hpp"
+
+ConfigShadow::ConfigShadow()
+{
+	for (uint8_t i = 0; i < SHADOW_REGISTERS; i++)
+	{
+		image_.regs[i] = 0;
+	}
+}
+
+uint16_t ConfigShadow::command(uint8_t index)
+{
+	if (index == 0)
+	{
+		return (Reg::REG_ACSTAT);
+	}
+	return ((uint16_t) (Reg::REG_MOD_1 + ((index - 1) * REG_ADDRESS_STEP)));
+}
+
+uint8_t ConfigShadow::index(uint16_t command)
+{
+	command = command & 0x03F0;
+	if (command == Reg::REG_ACSTAT)
+	{
+		return (0);
+	}
+	if ((command < Reg::REG_MOD_1) || (command > Reg::REG_TCO_Y))
+	{
+		return (SHADOW_REGISTERS);
+	}
+	return ((uint8_t) (((command - Reg::REG_MOD_1) / REG_ADDRESS_STEP) + 1));
+}
+
+errorTypes ConfigShadow::read(Tle5012b &sensor, Image_t &image)
+{
+	uint16_t acstat = 0;
+	if (sensor.sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	errorTypes status = sensor.readActivationStatus(acstat);
+	if (status == NO_ERROR)
+	{
+		status = sensor.readMoreRegisters(Reg::REG_MOD_1 | SHADOW_BURST_LENGTH, &image.regs[1]);
+	}
+	sensor.sBus->unlock();
+	image.regs[0] = acstat;
+	return (status);
+}
+
+errorTypes ConfigShadow::capture(Tle5012b &sensor)
+{
+	Image_t image;
+	errorTypes status = read(sensor, image);
+	if (status == NO_ERROR)
+	{
+		setImage(image);
+	}
+	return (status);
+}
+
+bool ConfigShadow::set(uint16_t command, uint16_t data)
+{
+	uint8_t i = index(command);
+	if (i >= SHADOW_REGISTERS)
+	{
+		return (false);
+	}
+	image_.regs[i] = data;
+	seal(image_);
+	return (true);
+}
+
+const ConfigShadow::Image_t &ConfigShadow::image() const
+{
+	return (image_);
+}
+
+void ConfigShadow::setImage(const Image_t &image)
+{
+	image_ = image;
+	seal(image_);
+}
+
+uint8_t ConfigShadow::crc(const Image_t &image)
+{
+	uint8_t temp[2 * CRC_NUM_REGISTERS];
+	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
+	{
+		temp[2 * i] = (uint8_t) (image.regs[SHADOW_CRC_FIRST + i] >> 8);
+		temp[(2 * i) + 1] = (uint8_t) image.regs[SHADOW_CRC_FIRST + i];
+	}
+	// the CRC byte itself is not part of the calculation
+	return (crcCalc(temp, (2 * CRC_NUM_REGISTERS) - 1));
+}
+
+void ConfigShadow::seal(Image_t &image)
+{
+	image.regs[0] = image.regs[0] & ~SHADOW_ACSTAT_TRIGGER;
+	image.regs[SHADOW_TCO_Y] = (image.regs[SHADOW_TCO_Y] & 0xFF00) | crc(image);
+}
+
+uint8_t ConfigShadow::diff(const Image_t &current, const Image_t &target, Write_t writes[])
+{
+	Image_t sealed = target;
+	uint8_t count = 0;
+	seal(sealed);
+	for (uint8_t i = 0; i < SHADOW_REGISTERS; i++)
+	{
+		uint16_t actual = (i == 0) ? (current.regs[0] & ~SHADOW_ACSTAT_TRIGGER) : current.regs[i];
+		if (actual != sealed.regs[i])
+		{
+			writes[count].command = command(i);
+			writes[count].data = sealed.regs[i];
+			count++;
+		}
+	}
+	return (count);
+}
+
+errorTypes ConfigShadow::write(Tle5012b &sensor, const Write_t writes[], uint8_t count)
+{
+	errorTypes status = NO_ERROR;
+	// the registers and their CRC in TCO_Y are written as one sequence
+	if (sensor.sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	for (uint8_t i = 0; (i < count) && (status == NO_ERROR); i++)
+	{
+		status = sensor.writeToSensor(writes[i].command, writes[i].data, false);
+	}
+	sensor.sBus->unlock();
+	return (status);
+}
+
+errorTypes ConfigShadow::apply(Tle5012b &sensor, const Image_t &target, uint8_t &count)
+{
+	Image_t current;
+	Write_t writes[SHADOW_REGISTERS];
+	count = 0;
+	// no other task may change the registers between the read and the writes
+	if (sensor.sBus->lock() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	errorTypes status = read(sensor, current);
+	if (status == NO_ERROR)
+	{
+		count = diff(current, target, writes);
+		status = write(sensor, writes, count);
+	}
+	sensor.sBus->unlock();
+	return (status);
+}
+
+errorTypes ConfigShadow::restore(Tle5012b &sensor, uint8_t &count)
+{
+	return (apply(sensor, image_, count));
+}
+
+uint8_t ConfigShadow::exportImage(const Image_t &image, uint8_t variant, uint8_t buffer[])
+{
+	Image_t sealed = image;
+	seal(sealed);
+	buffer[0] = (uint8_t) (SHADOW_IMAGE_MAGIC >> 8);
+	buffer[1] = (uint8_t) SHADOW_IMAGE_MAGIC;
+	buffer[2] = SHADOW_IMAGE_VERSION;
+	buffer[3] = variant;
+	for (uint8_t i = 0; i < SHADOW_REGISTERS; i++)
+	{
+		buffer[4 + (2 * i)] = (uint8_t) (sealed.regs[i] >> 8);
+		buffer[5 + (2 * i)] = (uint8_t) sealed.regs[i];
+	}
+	buffer[SHADOW_IMAGE_SIZE - 1] = crcCalc(buffer, SHADOW_IMAGE_SIZE - 1);
+	return (SHADOW_IMAGE_SIZE);
+}
+
+errorTypes ConfigShadow::importImage(const uint8_t buffer[], uint16_t length, Image_t &image, uint8_t &variant)
+{
+	uint8_t temp[SHADOW_IMAGE_SIZE];
+	if ((length != SHADOW_IMAGE_SIZE)
+		|| (buffer[0] != (uint8_t) (SHADOW_IMAGE_MAGIC >> 8))
+		|| (buffer[1] != (uint8_t) SHADOW_IMAGE_MAGIC)
+		|| (buffer[2] != SHADOW_IMAGE_VERSION))
+	{
+		return (SYSTEM_ERROR);
+	}
+	// crcCalc takes no const data
+	for (uint8_t i = 0; i < SHADOW_IMAGE_SIZE; i++)
+	{
+		temp[i] = buffer[i];
+	}
+	if (crcCalc(temp, SHADOW_IMAGE_SIZE - 1) != temp[SHADOW_IMAGE_SIZE - 1])
+	{
+		return (CRC_ERROR);
+	}
+	for (uint8_t i = 0; i < SHADOW_REGISTERS; i++)
+	{
+		image.regs[i] = (uint16_t) ((temp[4 + (2 * i)] << 8) | temp[5 + (2 * i)]);
+	}
+	variant = temp[3];
+	return (NO_ERROR);
+}
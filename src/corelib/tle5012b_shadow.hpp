@@ -0,0 +1,172 @@
+/*!
+ * \file        tle5012b_shadow.hpp
+ * \name        tle5012b_shadow.hpp - RAM shadow of the TLE5012B configuration registers.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The configuration of the sensor is held in ACSTAT and in the registers MOD_1
+ *              to TCO_Y. The registers 0x08 to 0x0F are protected with the CRC in the low
+ *              byte of TCO_Y. The shadow keeps an image of these eleven registers in RAM.
+ *              diff compares the image with the sensor content and returns the minimal
+ *              write sequence: only differing registers, with TCO_Y last and its CRC
+ *              already calculated from the image, so no CRC update cycle is needed.
+ *              For storage and transfer an image is exported into a versioned binary
+ *              form: magic, version, sensor variant, the eleven registers big endian
+ *              and a CRC8 over all bytes before it.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_SHADOW_HPP
+#define TLE5012B_SHADOW_HPP
+
+#include "TLE5012b.hpp"
+
+#define SHADOW_REGISTERS        11U         //!< \brief ACSTAT and MOD_1 to TCO_Y
+#define SHADOW_BURST_LENGTH     10U         //!< \brief registers MOD_1 to TCO_Y read with one burst
+#define SHADOW_CRC_FIRST        3U          //!< \brief image index of MOD_2, the first CRC protected register
+#define SHADOW_TCO_Y            10U         //!< \brief image index of TCO_Y with CRCPAR
+#define SHADOW_ACSTAT_TRIGGER   0x0401U     //!< \brief ASFRST and ASRST in ACSTAT, reset triggers which are never restored
+#define SHADOW_IMAGE_MAGIC      0x5412U     //!< \brief first two bytes of a binary image
+#define SHADOW_IMAGE_VERSION    1U          //!< \brief version of the binary image layout
+#define SHADOW_IMAGE_SIZE       27U         //!< \brief magic, version, variant, registers and CRC
+#define SHADOW_VARIANT_UNKNOWN  0xFFU       //!< \brief variant of a binary image without known sensor type
+
+/**
+ * @addtogroup tle5012recovery
+ *
+ * @{
+ */
+
+class ConfigShadow
+{
+	public:
+
+		//!< \brief register image, index 0 is ACSTAT, index 1 to 10 are MOD_1 to TCO_Y
+		struct Image_t
+		{
+			uint16_t regs[SHADOW_REGISTERS];     //!< \brief register values
+		};
+
+		//!< \brief one register write of a write sequence
+		struct Write_t
+		{
+			uint16_t command;        //!< \brief register address as used by writeToSensor
+			uint16_t data;           //!< \brief value to write
+		};
+
+		ConfigShadow();
+
+		/*!
+		* Reads the configuration of a sensor with two transfers
+		* @param [in] sensor sensor to read
+		* @param [out] image read registers
+		* @return CRC error type
+		*/
+		static errorTypes read(Tle5012b &sensor, Image_t &image);
+
+		/*!
+		* Reads the actual sensor configuration into the shadow,
+		* call it once the sensor is configured
+		* @param [in] sensor configured sensor
+		* @return CRC error type, the shadow is unchanged on error
+		*/
+		errorTypes capture(Tle5012b &sensor);
+
+		/*!
+		* Keeps the shadow in line with a register write done by the application
+		* @param [in] command register address as used by writeToSensor, e.g. reg.REG_MOD_2
+		* @param [in] data written value
+		* @return false if the register is not part of the image
+		*/
+		bool set(uint16_t command, uint16_t data);
+
+		//!< \brief the shadow image
+		const Image_t &image() const;
+
+		//!< \brief replaces the shadow image, the CRC of TCO_Y is recalculated
+		void setImage(const Image_t &image);
+
+		//!< \brief register address of an image index
+		static uint16_t command(uint8_t index);
+
+		//!< \brief image index of a register address or SHADOW_REGISTERS if not part of the image
+		static uint8_t index(uint16_t command);
+
+		//!< \brief CRCPAR of the CRC protected registers of an image
+		static uint8_t crc(const Image_t &image);
+
+		//!< \brief sets CRCPAR in TCO_Y and removes the reset triggers from ACSTAT
+		static void seal(Image_t &image);
+
+		/*!
+		* Minimal write sequence from one image to another. The target is sealed
+		* first, TCO_Y is always the last write.
+		* @param [in] current actual register values
+		* @param [in] target wanted register values
+		* @param [out] writes write sequence, needs SHADOW_REGISTERS entries
+		* @return number of writes
+		*/
+		static uint8_t diff(const Image_t &current, const Image_t &target, Write_t writes[]);
+
+		/*!
+		* Executes a write sequence without CRC update cycles
+		* @param [in] sensor sensor to write
+		* @param [in] writes write sequence from diff
+		* @param [in] count number of writes
+		* @return CRC error type of the first failing write
+		*/
+		static errorTypes write(Tle5012b &sensor, const Write_t writes[], uint8_t count);
+
+		/*!
+		* Diff and apply: reads the sensor configuration and writes only
+		* the registers which differ from the target
+		* @param [in] sensor sensor to write
+		* @param [in] target wanted register values
+		* @param [out] count number of written registers
+		* @return CRC error type
+		*/
+		static errorTypes apply(Tle5012b &sensor, const Image_t &target, uint8_t &count);
+
+		/*!
+		* Exports an image into the binary form, the image is sealed first
+		* @param [in] image register image
+		* @param [in] variant Reg::sensorType_t of the sensor or SHADOW_VARIANT_UNKNOWN
+		* @param [out] buffer binary image, needs SHADOW_IMAGE_SIZE bytes
+		* @return number of written bytes
+		*/
+		static uint8_t exportImage(const Image_t &image, uint8_t variant, uint8_t buffer[]);
+
+		/*!
+		* Imports an image from the binary form
+		* @param [in] buffer binary image
+		* @param [in] length number of bytes in buffer, exactly SHADOW_IMAGE_SIZE
+		* @param [out] image register image
+		* @param [out] variant Reg::sensorType_t of the sensor or SHADOW_VARIANT_UNKNOWN
+		* @return SYSTEM_ERROR for a wrong size, magic or version, CRC_ERROR for a wrong CRC
+		*/
+		static errorTypes importImage(const uint8_t buffer[], uint16_t length, Image_t &image, uint8_t &variant);
+
+		/*!
+		* Reads the sensor configuration and writes only the registers
+		* which differ from the shadow
+		* @param [in] sensor sensor to restore
+		* @param [out] count number of written registers
+		* @return CRC error type
+		*/
+		errorTypes restore(Tle5012b &sensor, uint8_t &count);
+
+	private:
+
+		Image_t     image_;          //!< \brief sealed register image
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_SHADOW_HPP */
@@ -0,0 +1,283 @@
+/*!
+ * \file        tle5012b_spc.cpp
+ * \name        tle5012b_spc.cpp - SPC (Short-PWM-Code) master for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_spc.hpp"
+
+//!< \brief CRC4 of the polynomial x^4 + x^3 + x^2 + 1 for each nibble
+static const uint8_t crc4Table[16] = { 0, 13, 7, 10, 14, 3, 9, 4, 1, 12, 6, 11, 15, 2, 8, 5 };
+
+//!< \brief unit time in ns for the IFADHYST values in SPC mode
+static const uint16_t unitTimeNs[4] = { 3000, 2500, 2000, 1500 };
+
+SPCDecoder::SPCDecoder():
+	config_(SPC_ANGLE_12)
+{
+}
+
+void SPCDecoder::configure(frameConfig_t config)
+{
+	config_ = config;
+}
+
+uint8_t SPCDecoder::dataNibbles() const
+{
+	return ((uint8_t) config_ + 3);
+}
+
+uint8_t SPCDecoder::frameEdges() const
+{
+	// trigger, end of sync, status, data nibbles and CRC
+	return (dataNibbles() + 4);
+}
+
+uint8_t SPCDecoder::crc4(const uint8_t nibbles[], uint8_t count)
+{
+	uint8_t crc = SPC_CRC_SEED;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		crc = (nibbles[i] & 0x0F) ^ crc4Table[crc];
+	}
+	// augmentation with a zero nibble
+	return (crc4Table[crc]);
+}
+
+errorTypes SPCDecoder::decode(const uint32_t edges[], uint8_t count, uint16_t syncUT, uint32_t nominalUT, Frame_t &frame) const
+{
+	uint8_t nibbles[SPC_MAX_NIBBLES + 2];
+	uint8_t total = dataNibbles() + 2;
+
+	if ((count < frameEdges()) || (syncUT == 0))
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	uint32_t sync = edges[1] - edges[0];
+	uint32_t unitTime = (uint32_t) (((uint64_t) sync << 8) / syncUT);
+	if (nominalUT != 0)
+	{
+		uint32_t deviation = (unitTime > nominalUT) ? (unitTime - nominalUT) : (nominalUT - unitTime);
+		if (deviation * 100 > nominalUT * SPC_SYNC_TOLERANCE)
+		{
+			return (INTERFACE_ACCESS_ERROR);
+		}
+	}
+	if (sync == 0)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+
+	for (uint8_t i = 0; i < total; i++)
+	{
+		uint64_t interval = edges[i + 2] - edges[i + 1];
+		// unit times rounded to the next integer, calibrated with the sync period
+		uint32_t units = (uint32_t) ((2 * interval * syncUT + sync) / (2 * (uint64_t) sync));
+		if ((units < SPC_NIBBLE_UT) || (units > SPC_NIBBLE_UT + 15))
+		{
+			return (INTERFACE_ACCESS_ERROR);
+		}
+		nibbles[i] = (uint8_t) (units - SPC_NIBBLE_UT);
+	}
+	if (crc4(nibbles, total - 1) != nibbles[total - 1])
+	{
+		return (CRC_ERROR);
+	}
+
+	const uint8_t *data = &nibbles[1];
+	uint8_t angleNibbles = ((config_ == SPC_ANGLE_16) || (config_ == SPC_ANGLE_16_TEMP)) ? 4 : 3;
+	uint16_t angle = 0;
+	for (uint8_t i = 0; i < angleNibbles; i++)
+	{
+		angle = (angle << 4) | data[i];
+	}
+	uint16_t raw = (angleNibbles == 3) ? (uint16_t) (angle << 3) : (uint16_t) (angle >> 1);
+	raw = (raw & (DELETE_BIT_15));
+	if (raw & (CHECK_BIT_14))
+	{
+		raw = raw - (CHANGE_UINT_TO_INT_15);
+	}
+
+	frame.status = nibbles[0];
+	frame.angle = angle;
+	frame.rawAngle = (int16_t) raw;
+	frame.temperature = (config_ >= SPC_ANGLE_12_TEMP) ? (uint8_t) ((data[angleNibbles] << 4) | data[angleNibbles + 1]) : 0;
+	frame.unitTime = unitTime;
+	return (NO_ERROR);
+}
+
+Tle5012bSPC::Tle5012bSPC(GPIO &trigger, Capture &capture, uint8_t driveMode, uint8_t releaseMode, uint8_t channel):
+	trigger_(trigger),
+	capture_(capture),
+	driveMode_(driveMode),
+	releaseMode_(releaseMode),
+	channel_(channel),
+	armed_(false),
+	count_(0)
+{
+	configure(0, 0, 0);
+}
+
+Tle5012bSPC::~Tle5012bSPC()
+{
+	end();
+}
+
+void Tle5012bSPC::configure(uint8_t hysteresis, uint8_t frameConfig, uint8_t triggerTime)
+{
+	hysteresis_ = hysteresis & 0x03;
+	triggerTime_ = triggerTime & 0x01;
+	decoder_.configure((SPCDecoder::frameConfig_t) (frameConfig & 0x03));
+	unitTime_ = (uint32_t) (((uint64_t) capture_.tickRate() * unitTimeNs[hysteresis_] * 256) / 1000000000UL);
+	clearStats();
+}
+
+errorTypes Tle5012bSPC::configure(Tle5012b &sensor)
+{
+	uint16_t ifab = 0;
+	uint16_t mod4 = 0;
+	errorTypes status = sensor.readIFAB(ifab);
+	if (status == NO_ERROR)
+	{
+		status = sensor.readIntMode4(mod4);
+	}
+	if (status == NO_ERROR)
+	{
+		configure(Reg::REG_IFAB_IFADHYST::extract(ifab),
+			Reg::REG_MOD_4_IFABRES::extract(mod4),
+			Reg::REG_MOD_4_HSMPLP::extract(mod4) & 0x01);
+	}
+	return (status);
+}
+
+errorTypes Tle5012bSPC::begin()
+{
+	if (unitTime_ < (SPC_MIN_UT_TICKS << 8))
+	{
+		return (SYSTEM_ERROR);
+	}
+	trigger_.changeMode(releaseMode_);
+	armed_ = false;
+	return ((capture_.init(onEdge, this) == Capture::OK) ? NO_ERROR : INTERFACE_ACCESS_ERROR);
+}
+
+void Tle5012bSPC::end()
+{
+	armed_ = false;
+	capture_.deinit();
+}
+
+errorTypes Tle5012bSPC::read(uint8_t slave, SPCDecoder::Frame_t &frame)
+{
+	uint32_t edges[SPC_MAX_EDGES];
+
+	if ((slave >= SPC_MAX_SLAVES) || (unitTime_ < (SPC_MIN_UT_TICKS << 8)))
+	{
+		return (SYSTEM_ERROR);
+	}
+	uint16_t lowUT = SPC_TRIGGER_UT * (slave + 1);
+	uint16_t syncUT = (triggerTime_ == 0) ? SPC_SYNC_UT : (lowUT + SPC_TRIGGER_UT);
+	uint8_t needed = decoder_.frameEdges();
+	uint32_t timeout = (unitTime_ * SPC_TIMEOUT_UT) >> 8;
+
+	count_ = 0;
+	armed_ = true;
+	// the falling edge of the trigger is captured as the first edge
+	trigger_.write(GPIO::GPIO_LOW);
+	trigger_.changeMode(driveMode_);
+	waitTicks((unitTime_ * lowUT + 255) >> 8);
+	trigger_.changeMode(releaseMode_);
+
+	uint32_t start = capture_.now();
+	while ((count_ < needed) && ((capture_.now() - start) < timeout))
+	{
+	}
+	armed_ = false;
+
+	uint8_t count = count_;
+	if (count < needed)
+	{
+		stats_.timeouts++;
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	for (uint8_t i = 0; i < needed; i++)
+	{
+		edges[i] = edges_[i];
+	}
+	errorTypes status = decoder_.decode(edges, needed, syncUT, unitTime_, frame);
+	if (status == NO_ERROR)
+	{
+		stats_.frames++;
+	}else if (status == CRC_ERROR)
+	{
+		stats_.crcErrors++;
+	}else{
+		stats_.frameErrors++;
+	}
+	return (status);
+}
+
+errorTypes Tle5012bSPC::readAll(SPCDecoder::Frame_t frames[], uint8_t count)
+{
+	errorTypes first = NO_ERROR;
+	if (count > SPC_MAX_SLAVES)
+	{
+		count = SPC_MAX_SLAVES;
+	}
+	for (uint8_t slave = 0; slave < count; slave++)
+	{
+		errorTypes status = read(slave, frames[slave]);
+		if (first == NO_ERROR)
+		{
+			first = status;
+		}
+	}
+	return (first);
+}
+
+uint32_t Tle5012bSPC::unitTime() const
+{
+	return (unitTime_);
+}
+
+const Tle5012bSPC::Stats_t &Tle5012bSPC::getStats() const
+{
+	return (stats_);
+}
+
+void Tle5012bSPC::clearStats()
+{
+	stats_.frames = 0;
+	stats_.timeouts = 0;
+	stats_.frameErrors = 0;
+	stats_.crcErrors = 0;
+}
+
+void Tle5012bSPC::waitTicks(uint32_t ticks)
+{
+	uint32_t start = capture_.now();
+	while ((capture_.now() - start) < ticks)
+	{
+	}
+}
+
+void Tle5012bSPC::onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg)
+{
+	Tle5012bSPC *self = (Tle5012bSPC *) arg;
+	if (!self->armed_ || (channel != self->channel_) || level)
+	{
+		return;
+	}
+	if (self->count_ < SPC_MAX_EDGES)
+	{
+		self->edges_[self->count_] = timestamp;
+		self->count_ = self->count_ + 1;
+	}
+}
@@ -0,0 +1,210 @@
+/*!
+ * \file        tle5012b_spc.hpp
+ * \name        tle5012b_spc.hpp - SPC (Short-PWM-Code) master for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The TLE5012B-E9000 sends a SPC frame only after a trigger pulse of the master
+ *              on IFA. The length of the low pulse selects one of four sensors on the line.
+ *              The frame is a sequence of falling edges: the trigger edge, the end of the
+ *              synchronization period, the status nibble, 3 to 6 data nibbles and the CRC
+ *              nibble. Each nibble lasts 12 + value unit times (UT). The SPCDecoder measures
+ *              the synchronization period of each frame to calibrate the unit time and
+ *              decodes the nibbles from the falling edge timestamps. It has no hardware
+ *              dependency. Tle5012bSPC generates the trigger with a GPIO and captures the
+ *              edges with the capture PAL.
+ *              The nibbles differ by one UT of 1.5 to 3.0 µs, so the capture needs at least
+ *              SPC_MIN_UT_TICKS ticks per UT, a timer input capture of 2.7 MHz for 3.0 µs and
+ *              5.4 MHz for 1.5 µs. Captures with microsecond timestamps, like the Arduino
+ *              capture PAL with micros(), are too coarse and are rejected by begin and read.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_SPC_HPP
+#define TLE5012B_SPC_HPP
+
+#include "../pal/capture.hpp"
+#include "../pal/gpio.hpp"
+#include "TLE5012b.hpp"
+
+#define SPC_MAX_SLAVES          4U      //!< \brief sensors on one SPC line
+#define SPC_MAX_NIBBLES         6U      //!< \brief data nibbles of the longest frame
+#define SPC_MAX_EDGES           (SPC_MAX_NIBBLES + 4U)  //!< \brief falling edges of the longest frame
+#define SPC_NIBBLE_UT           12U     //!< \brief unit times of a nibble with value 0
+#define SPC_TRIGGER_UT          12U     //!< \brief trigger low time of the first sensor, multiplied by the slave number
+#define SPC_SYNC_UT             90U     //!< \brief synchronization period with the default total trigger time
+#define SPC_SYNC_TOLERANCE      25U     //!< \brief allowed unit time deviation in percent
+#define SPC_CRC_SEED            0x05U   //!< \brief CRC4 seed 0101
+#define SPC_TIMEOUT_UT          400U    //!< \brief longest frame including the trigger
+#define SPC_MIN_UT_TICKS        8U      //!< \brief shortest unit time in capture ticks which still separates the nibbles
+
+/**
+ * @addtogroup tle5012spc
+ *
+ * @{
+ */
+
+class SPCDecoder
+{
+	public:
+
+		//!< \brief data layout of the SPC frame, same values than IFABRES in SPC mode
+		enum frameConfig_t
+		{
+			SPC_ANGLE_12      = 0,   //!< \brief 12 bit angle, 3 nibbles
+			SPC_ANGLE_16      = 1,   //!< \brief 16 bit angle, 4 nibbles
+			SPC_ANGLE_12_TEMP = 2,   //!< \brief 12 bit angle and 8 bit temperature, 5 nibbles
+			SPC_ANGLE_16_TEMP = 3    //!< \brief 16 bit angle and 8 bit temperature, 6 nibbles
+		};
+
+		//!< \brief decoded SPC frame
+		struct Frame_t
+		{
+			uint8_t  status;         //!< \brief status nibble
+			uint16_t angle;          //!< \brief angle as sent, 12 or 16 bit
+			int16_t  rawAngle;       //!< \brief signed 15 bit raw angle value, same unit than AVAL
+			uint8_t  temperature;    //!< \brief temperature byte as sent, 0 without temperature
+			uint32_t unitTime;       //!< \brief measured unit time in 1/256 ticks
+		};
+
+		SPCDecoder();
+
+		/*!
+		* Sets the frame layout
+		* @param [in] config data layout of the frame
+		*/
+		void configure(frameConfig_t config);
+
+		//!< \brief number of data nibbles of the set frame layout
+		uint8_t dataNibbles() const;
+
+		//!< \brief number of falling edges of one frame including the trigger edge
+		uint8_t frameEdges() const;
+
+		/*!
+		* Decodes one frame
+		* @param [in] edges falling edge timestamps, the first one is the trigger edge
+		* @param [in] count number of timestamps
+		* @param [in] syncUT length of the synchronization period in unit times
+		* @param [in] nominalUT expected unit time in ticks, the sync period must be within SPC_SYNC_TOLERANCE
+		* @param [out] frame decoded frame
+		* @return CRC error type, INTERFACE_ACCESS_ERROR for a frame error, CRC_ERROR for a CRC4 mismatch
+		*/
+		errorTypes decode(const uint32_t edges[], uint8_t count, uint16_t syncUT, uint32_t nominalUT, Frame_t &frame) const;
+
+		/*!
+		* SAE J2716 CRC4, polynomial x^4 + x^3 + x^2 + 1 and seed 0101
+		* @param [in] nibbles status and data nibbles
+		* @param [in] count number of nibbles
+		* @return CRC4 value
+		*/
+		static uint8_t crc4(const uint8_t nibbles[], uint8_t count);
+
+	private:
+
+		frameConfig_t   config_;     //!< \brief data layout of the frame
+};
+
+class Tle5012bSPC
+{
+	public:
+
+		//!< \brief statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t frames;         //!< \brief number of valid frames
+			uint32_t timeouts;       //!< \brief triggers without a complete frame
+			uint32_t frameErrors;    //!< \brief frames with a wrong sync period or nibble
+			uint32_t crcErrors;      //!< \brief frames with a CRC4 mismatch
+		};
+
+		/*!
+		* @param [in] trigger GPIO of IFA, must not drive the line high while released
+		* @param [in] capture edge capture of IFA
+		* @param [in] driveMode GPIO mode which drives the line low, e.g. OUTPUT
+		* @param [in] releaseMode GPIO mode which releases the line to the pull up, e.g. INPUT
+		* @param [in] channel capture channel of IFA
+		*/
+		Tle5012bSPC(GPIO &trigger, Capture &capture, uint8_t driveMode, uint8_t releaseMode, uint8_t channel=0);
+		~Tle5012bSPC();
+
+		/*!
+		* Sets the SPC parameters
+		* @param [in] hysteresis IFADHYST value of IFAB, unit time 0 = 3.0 µs, 1 = 2.5 µs, 2 = 2.0 µs, 3 = 1.5 µs
+		* @param [in] frameConfig IFABRES value of MOD_4, the frame layout
+		* @param [in] triggerTime bit 0 of HSMPLP of MOD_4, 0 = 90 UT total trigger time, 1 = trigger low time + 12 UT
+		*/
+		void configure(uint8_t hysteresis, uint8_t frameConfig, uint8_t triggerTime);
+
+		/*!
+		* Reads the SPC parameters over SSC
+		* @param [in] sensor sensor with SSC access
+		* @return CRC error type
+		*/
+		errorTypes configure(Tle5012b &sensor);
+
+		/*!
+		* Starts the capture
+		* @return CRC error type, SYSTEM_ERROR if the unit time is shorter than SPC_MIN_UT_TICKS capture ticks
+		*/
+		errorTypes begin();
+
+		//!< \brief stops the capture
+		void end();
+
+		/*!
+		* Triggers one sensor and decodes its frame
+		* @param [in] slave SPC slave number 0 to 3
+		* @param [out] frame decoded frame
+		* @return CRC error type, INTERFACE_ACCESS_ERROR for a timeout or frame error,
+		* SYSTEM_ERROR for a wrong slave number or a too coarse capture
+		*/
+		errorTypes read(uint8_t slave, SPCDecoder::Frame_t &frame);
+
+		/*!
+		* Reads the first count sensors of the line one after the other
+		* @param [out] frames decoded frames, index is the slave number
+		* @param [in] count number of sensors, maximum SPC_MAX_SLAVES
+		* @return first error of all frames
+		*/
+		errorTypes readAll(SPCDecoder::Frame_t frames[], uint8_t count);
+
+		//!< \brief nominal unit time in capture ticks
+		uint32_t unitTime() const;
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics
+		void clearStats();
+
+	private:
+
+		GPIO                &trigger_;                 //!< \brief IFA output
+		Capture             &capture_;                 //!< \brief IFA edge capture
+		SPCDecoder          decoder_;                  //!< \brief frame decoder
+		uint8_t             driveMode_;                //!< \brief GPIO mode driving the line
+		uint8_t             releaseMode_;              //!< \brief GPIO mode releasing the line
+		uint8_t             channel_;                  //!< \brief capture channel of IFA
+		uint8_t             hysteresis_;               //!< \brief unit time selection
+		uint8_t             triggerTime_;              //!< \brief total trigger time selection
+		uint32_t            unitTime_;                 //!< \brief nominal unit time in ticks
+		volatile bool       armed_;                    //!< \brief edges are collected while a frame is expected
+		volatile uint8_t    count_;                    //!< \brief captured falling edges
+		volatile uint32_t   edges_[SPC_MAX_EDGES];     //!< \brief falling edge timestamps
+		Stats_t             stats_;                    //!< \brief statistics
+
+		void waitTicks(uint32_t ticks);
+		static void onEdge(uint8_t channel, bool level, uint32_t timestamp, void *arg);
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_SPC_HPP */
@@ -0,0 +1,199 @@
+/*!
+ * \file        tle5012b_tempcomp.cpp
+ * \name        tle5012b_tempcomp.cpp - temperature indexed offset compensation for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "tle5012b_tempcomp.hpp"
+
+#define TEMPCOMP_OFFX           2U      //!< \brief index of OFFX in the CRC block from MOD_2
+#define TEMPCOMP_OFFY           3U      //!< \brief index of OFFY in the CRC block from MOD_2
+#define TEMPCOMP_MOD_4          6U      //!< \brief index of MOD_4 in the CRC block from MOD_2
+#define TEMPCOMP_TCO_Y          7U      //!< \brief index of TCO_Y in the CRC block from MOD_2
+
+/*!
+ * Converts the 15 bit two's complement value of AVAL/ASPD into int16_t
+ */
+static int16_t toSigned15(uint16_t rawData)
+{
+	rawData = (rawData & (DELETE_BIT_15));
+	if (rawData & CHECK_BIT_14)
+	{
+		rawData = rawData - CHANGE_UINT_TO_INT_15;
+	}
+	return ((int16_t) rawData);
+}
+
+/*!
+ * Converts the 9 bit two's complement value of AREV/FSYNC into int16_t
+ */
+static int16_t toSigned9(uint16_t rawData)
+{
+	rawData = (rawData & (DELETE_7BITS));
+	if (rawData & CHECK_BIT_9)
+	{
+		rawData = rawData - CHANGE_UNIT_TO_INT_9;
+	}
+	return ((int16_t) rawData);
+}
+
+Tle5012bTempComp::Tle5012bTempComp(Tle5012b &sensor):
+	sensor_(sensor),
+	count_(0),
+	hysteresis_(0),
+	band_(TEMPCOMP_NO_BAND)
+{
+	clearStats();
+}
+
+int16_t Tle5012bTempComp::toRaw(int16_t celsius)
+{
+	double raw = (celsius * TEMP_DIV) - TEMP_OFFSET;
+	return ((int16_t) ((raw < 0.0) ? (raw - 0.5) : (raw + 0.5)));
+}
+
+double Tle5012bTempComp::toCelsius(int16_t rawTemp)
+{
+	return ((rawTemp + TEMP_OFFSET) / (TEMP_DIV));
+}
+
+errorTypes Tle5012bTempComp::setTable(const Point_t points[], uint8_t count, uint8_t hysteresis)
+{
+	if ((count == 0) || (count > TEMPCOMP_MAX_POINTS))
+	{
+		return (SYSTEM_ERROR);
+	}
+	for (uint8_t i = 1; i < count; i++)
+	{
+		if (points[i].temperature <= points[i - 1].temperature)
+		{
+			return (SYSTEM_ERROR);
+		}
+	}
+	for (uint8_t i = 0; i < count; i++)
+	{
+		points_[i] = points[i];
+		// each band starts in the middle between two points
+		lower_[i] = (i == 0) ? INT16_MIN : toRaw((points[i - 1].temperature + points[i].temperature) / 2);
+	}
+	count_ = count;
+	hysteresis_ = (int16_t) (hysteresis * TEMP_DIV + 0.5);
+	band_ = TEMPCOMP_NO_BAND;
+	return (NO_ERROR);
+}
+
+uint8_t Tle5012bTempComp::select(int16_t rawTemp) const
+{
+	uint8_t index = 0;
+	while ((index + 1 < count_) && (rawTemp >= lower_[index + 1]))
+	{
+		index++;
+	}
+	return (index);
+}
+
+errorTypes Tle5012bTempComp::sample(Sample_t &out, updTypes upd, safetyTypes safe)
+{
+	uint16_t rawData[4] = {0};
+	// AVAL, ASPD, AREV and FSYNC are consecutive registers
+	errorTypes status = sensor_.readMoreRegisters(sensor_.reg.REG_AVAL | 0x4, rawData, upd, safe);
+	stats_.samples++;
+	if (status != NO_ERROR)
+	{
+		stats_.errors++;
+		return (status);
+	}
+	out.rawAngle = toSigned15(rawData[0]);
+	out.rawSpeed = toSigned15(rawData[1]);
+	out.revolutions = toSigned9(rawData[2]);
+	out.rawTemp = toSigned9(rawData[3]);
+	return (update(out.rawTemp));
+}
+
+errorTypes Tle5012bTempComp::update(int16_t rawTemp)
+{
+	if (count_ == 0)
+	{
+		return (NO_ERROR);
+	}
+	if (band_ != TEMPCOMP_NO_BAND)
+	{
+		// stay in the active band until the temperature leaves it by more than the hysteresis
+		int32_t lower = (band_ == 0) ? INT32_MIN : (int32_t) lower_[band_] - hysteresis_;
+		int32_t upper = (band_ + 1 >= count_) ? INT32_MAX : (int32_t) lower_[band_ + 1] + hysteresis_;
+		if ((rawTemp >= lower) && (rawTemp < upper))
+		{
+			return (NO_ERROR);
+		}
+	}
+	return (apply(select(rawTemp)));
+}
+
+errorTypes Tle5012bTempComp::apply(uint8_t index)
+{
+	uint16_t image[CRC_NUM_REGISTERS] = {0};
+	uint8_t writes = 0;
+
+	if (index >= count_)
+	{
+		return (SYSTEM_ERROR);
+	}
+	// the read and the writes are one sequence on a shared bus
+	if (sensor_.sBus->lock() != SPIC::OK)
+	{
+		stats_.errors++;
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	// MOD_2 to TCO_Y with one burst, the other fields of the CRC block are kept
+	errorTypes status = sensor_.readMoreRegisters(sensor_.reg.REG_MOD_2 | CRC_NUM_REGISTERS, image);
+	if (status == NO_ERROR)
+	{
+		const Point_t &point = points_[index];
+		image[TEMPCOMP_OFFX] = Reg::REG_OFFX_XOFFSET::insert(image[TEMPCOMP_OFFX], (uint16_t) point.offsetX);
+		image[TEMPCOMP_OFFY] = Reg::REG_OFFY_YOFFSET::insert(image[TEMPCOMP_OFFY], (uint16_t) point.offsetY);
+		image[TEMPCOMP_MOD_4] = Reg::REG_MOD_4_TCOXT::insert(image[TEMPCOMP_MOD_4], (uint16_t) point.tcoX);
+		image[TEMPCOMP_TCO_Y] = Reg::REG_TCO_Y_TCOYT::insert(image[TEMPCOMP_TCO_Y], (uint16_t) point.tcoY);
+		// only changed registers are written, TCO_Y last with the new CRC and the new TCOYT
+		status = sensor_.applyConfigBlock(image, &writes);
+	}
+	sensor_.sBus->unlock();
+	stats_.writes += writes;
+	if (status != NO_ERROR)
+	{
+		stats_.errors++;
+		return (status);
+	}
+	band_ = (int8_t) index;
+	stats_.updates++;
+	return (NO_ERROR);
+}
+
+int8_t Tle5012bTempComp::band() const
+{
+	return (band_);
+}
+
+void Tle5012bTempComp::reset()
+{
+	band_ = TEMPCOMP_NO_BAND;
+}
+
+const Tle5012bTempComp::Stats_t &Tle5012bTempComp::getStats() const
+{
+	return (stats_);
+}
+
+void Tle5012bTempComp::clearStats()
+{
+	stats_.samples = 0;
+	stats_.updates = 0;
+	stats_.writes = 0;
+	stats_.errors = 0;
+}
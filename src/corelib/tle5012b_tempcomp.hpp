@@ -0,0 +1,141 @@
+/*!
+ * \file        tle5012b_tempcomp.hpp
+ * \name        tle5012b_tempcomp.hpp - temperature indexed offset compensation for the TLE5012B angle sensor.
+ * \author      Infineon Technologies AG
+ * \copyright   2019-2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \brief       GMR-based angle sensor for angular position sensing in automotive applications
+ * \details
+ *              The sensor corrects the X/Y offsets with OFFX/OFFY at 25°C and a linear
+ *              temperature coefficient TCOXT/TCOYT. Over a wide temperature range a single
+ *              coefficient is often not enough. The manager keeps a small table of offset
+ *              and coefficient sets, each one for a temperature point. The temperature is
+ *              read with the angle in the same burst, as FSYNC follows AVAL, ASPD and AREV.
+ *              When the temperature leaves the band of the active table point, the new set
+ *              is written with Tle5012b::applyConfigBlock, TCO_Y with the new coefficient and
+ *              the CRC of the configuration registers is the last and only CRC write.
+ * \ref         tle5012corelib
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012B_TEMPCOMP_HPP
+#define TLE5012B_TEMPCOMP_HPP
+
+#include "TLE5012b.hpp"
+
+#define TEMPCOMP_MAX_POINTS     8U      //!< \brief maximum number of table points
+#define TEMPCOMP_HYSTERESIS     2U      //!< \brief default band hysteresis in °C
+#define TEMPCOMP_NO_BAND        (-1)    //!< \brief no table point applied yet
+
+/**
+ * @addtogroup tle5012tempcomp
+ *
+ * @{
+ */
+
+class Tle5012bTempComp
+{
+	public:
+
+		//!< \brief offset and temperature coefficient set of one temperature point
+		struct Point_t
+		{
+			int16_t temperature;     //!< \brief temperature of the point in °C
+			int16_t offsetX;         //!< \brief 12 bit signed XOFFSET of OFFX
+			int16_t offsetY;         //!< \brief 12 bit signed YOFFSET of OFFY
+			int8_t  tcoX;            //!< \brief 7 bit signed TCOXT of MOD_4
+			int8_t  tcoY;            //!< \brief 7 bit signed TCOYT of TCO_Y
+		};
+
+		//!< \brief decoded values of one burst
+		struct Sample_t
+		{
+			int16_t rawAngle;        //!< \brief signed 15 bit raw angle value
+			int16_t rawSpeed;        //!< \brief signed 15 bit raw angle speed value
+			int16_t revolutions;     //!< \brief signed 9 bit number of revolutions
+			int16_t rawTemp;         //!< \brief signed 9 bit raw temperature value
+		};
+
+		//!< \brief statistics since the last clearStats
+		struct Stats_t
+		{
+			uint32_t samples;        //!< \brief number of bursts
+			uint32_t updates;        //!< \brief number of written table points
+			uint32_t writes;         //!< \brief number of written registers
+			uint32_t errors;         //!< \brief failed reads or writes
+		};
+
+		Tle5012bTempComp(Tle5012b &sensor);
+
+		/*!
+		* Sets the compensation table, the points are copied
+		* @param [in] points table points sorted by rising temperature
+		* @param [in] count number of points, 1 to TEMPCOMP_MAX_POINTS
+		* @param [in] hysteresis band hysteresis in °C
+		* @return SYSTEM_ERROR for an empty, too long or unsorted table
+		*/
+		errorTypes setTable(const Point_t points[], uint8_t count, uint8_t hysteresis=TEMPCOMP_HYSTERESIS);
+
+		/*!
+		* Reads AVAL, ASPD, AREV and FSYNC with one burst and updates
+		* the compensation with the temperature of the burst
+		* @param [out] out decoded values
+		* @param [in] upd read from update (UPD_high) register or directly (default, UPD_low)
+		* @param [in] safe generate safety word (default, SAFE_high) or no (SAFE_low)
+		* @return CRC error type of the burst or of the update
+		*/
+		errorTypes sample(Sample_t &out, updTypes upd=UPD_low, safetyTypes safe=SAFE_high);
+
+		/*!
+		* Writes the table point of the band if the temperature left the active band
+		* @param [in] rawTemp signed 9 bit raw temperature value
+		* @return CRC error type
+		*/
+		errorTypes update(int16_t rawTemp);
+
+		/*!
+		* Writes one table point to the sensor. Only changed registers are
+		* written, TCO_Y last with the new CRC, so no CRC update cycle is needed.
+		* @param [in] index table point
+		* @return CRC error type, SYSTEM_ERROR for an invalid index
+		*/
+		errorTypes apply(uint8_t index);
+
+		//!< \brief index of the active table point or TEMPCOMP_NO_BAND
+		int8_t band() const;
+
+		//!< \brief forgets the active table point, the next update writes again
+		void reset();
+
+		//!< \brief converts °C into the raw temperature value
+		static int16_t toRaw(int16_t celsius);
+
+		//!< \brief converts the raw temperature value into °C
+		static double toCelsius(int16_t rawTemp);
+
+		//!< \brief returns the statistics
+		const Stats_t &getStats() const;
+
+		//!< \brief clears the statistics
+		void clearStats();
+
+	private:
+
+		Tle5012b    &sensor_;                        //!< \brief compensated sensor
+		Point_t     points_[TEMPCOMP_MAX_POINTS];    //!< \brief table points
+		int16_t     lower_[TEMPCOMP_MAX_POINTS];     //!< \brief raw temperature where the band of each point starts
+		uint8_t     count_;                          //!< \brief number of table points
+		int16_t     hysteresis_;                     //!< \brief band hysteresis in raw temperature digits
+		int8_t      band_;                           //!< \brief active table point
+		Stats_t     stats_;                          //!< \brief statistics
+
+		uint8_t select(int16_t rawTemp) const;
+};
+
+/**
+ * @}
+ */
+
+#endif /* TLE5012B_TEMPCOMP_HPP */
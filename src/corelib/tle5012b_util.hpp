@@ -43,12 +43,19 @@
 #define SYSTEM_ERROR_MASK           0x4000    //!< \brief System error masks for safety words
 #define INTERFACE_ERROR_MASK        0x2000    //!< \brief Interface error masks for safety words
 #define INV_ANGLE_ERROR_MASK        0x1000    //!< \brief Angle error masks for safety words
+#define RESET_INDICATION_MASK       0x8000    //!< \brief Chip reset or watchdog overflow indication in safety words
 
 #define CRC_POLYNOMIAL              0x1D      //!< \brief values used for calculating the CRC
 #define CRC_SEED                    0xFF
 #define CRC_NUM_REGISTERS           0x0008    //!< \brief number of CRC relevant registers
 #define MAX_REGISTER_MEM            0x0030    //!< \brief max readable register values buffer
 #define MAX_NUM_REG                 0x16      //!< \brief defines the value for temporary data to read all readable registers
+#define MAX_BURST_LENGTH            0x0F      //!< \brief max number of data words in one read command
+#define REG_ADDRESS_STEP            0x0010    //!< \brief command word distance of two consecutive register addresses
+#define TYPE_BURST_LENGTH           0x09      //!< \brief number of registers from MOD_1 to MOD_4 for the sensor type
+#define SPEED_PROBE_STEP            1000000U  //!< \brief clock increment of the SPI speed probe in Hz
+#define SPEED_PROBE_READS           0x08      //!< \brief number of CRC checked bursts per probed clock
+#define SPEED_PROBE_LENGTH          0x0A      //!< \brief probe burst length, registers MOD_1 to TCO_Y
 
 #define DELETE_BIT_15               0x7FFF    //!< \brief Value used to delete everything except the first 15 bits
 #define CHANGE_UINT_TO_INT_15       0x8000    //!< \brief Value used to change unsigned 16bit integer into signed
@@ -66,6 +73,14 @@
 #define TEMP_OFFSET                 152.0     //!< \brief values used to calculate the temperature
 #define TEMP_DIV                    2.776
 
+/*!
+ * Function for calculation of the CRC of safety words and of the CRC register block
+ * @param crcData byte long data for CRC check
+ * @param length length of data
+ * @return 8bit CRC
+ */
+uint8_t crcCalc(uint8_t* crcData, uint8_t length);
+
 /**
  * @brief Error types from safety word
  */
@@ -15,6 +15,11 @@
  * @addtogroup arduinoPal
  */
 
+#if defined(XMC1100_XMC2GO) || defined(XMC1100_H_BRIDGE2GO)
+	#undef PIN_SPI_EN
+	#define PIN_SPI_EN    8           /*!< TLE5012 Sensor2Go Kit has a switch on/off pin */
+#endif
+
 /**
  * Construct a new Tle5012Ino::Tle5012Ino object with default SPI and pin assignment.
  * Use this if:
@@ -22,10 +27,12 @@
  * - attached the breakout board on the default SPI of your MCU
  * - attached a bulk chip with the SSC interface to the default SPI of your MCU
  */
-Tle5012Ino::Tle5012Ino():Tle5012b()
+Tle5012Ino::Tle5012Ino():Tle5012b(),
+	spic(),
+	enPin(PIN_SPI_EN, OUTPUT, GPIOIno::POSITIVE)
 {
 	Tle5012b::mSlave = TLE5012B_S0;
-	Tle5012b::sBus = new SPICIno();
+	Tle5012b::sBus = &spic;
 }
 
 /**
@@ -36,10 +43,12 @@ Tle5012Ino::Tle5012Ino():Tle5012b()
  * @param csPin    pin number of the CS pin
  * @param slave    optional sensor slave setting
  */
-Tle5012Ino::Tle5012Ino(uint8_t csPin, slaveNum slave):Tle5012b()
+Tle5012Ino::Tle5012Ino(uint8_t csPin, slaveNum slave):Tle5012b(),
+	spic(csPin),
+	enPin(PIN_SPI_EN, OUTPUT, GPIOIno::POSITIVE)
 {
 	Tle5012b::mSlave = slave;
-	Tle5012b::sBus = new SPICIno(csPin);
+	Tle5012b::sBus = &spic;
 }
 
 /**
@@ -55,10 +64,24 @@ Tle5012Ino::Tle5012Ino(uint8_t csPin, slaveNum slave):Tle5012b()
  * @param sckPin   system clock pin for external sensor clock setting
  * @param slave    optional sensor slave setting
  */
-Tle5012Ino::Tle5012Ino(SPIClass3W &bus, uint8_t csPin, uint8_t misoPin, uint8_t mosiPin, uint8_t sckPin, slaveNum slave):Tle5012b()
+Tle5012Ino::Tle5012Ino(SPIClass3W &bus, uint8_t csPin, uint8_t misoPin, uint8_t mosiPin, uint8_t sckPin, slaveNum slave):Tle5012b(),
+	spic(bus,csPin,misoPin,mosiPin,sckPin),
+	enPin(PIN_SPI_EN, OUTPUT, GPIOIno::POSITIVE)
 {
 	Tle5012b::mSlave = slave;
-	Tle5012b::sBus = new SPICIno(bus,csPin,misoPin,mosiPin,sckPin);
+	Tle5012b::sBus = &spic;
+}
+
+/**
+ * @brief Destroy the Tle5012Ino::Tle5012Ino object
+ * The SPI cover and enable pin are members and are gone before the
+ * base destructor runs, so the bus is released here.
+ */
+Tle5012Ino::~Tle5012Ino()
+{
+	end();
+	Tle5012b::sBus = NULL;
+	Tle5012b::en = NULL;
 }
 
 /**
@@ -71,22 +94,38 @@ Tle5012Ino::Tle5012Ino(SPIClass3W &bus, uint8_t csPin, uint8_t misoPin, uint8_t
  */
 errorTypes Tle5012Ino::begin(void)
 {
-	#if defined(XMC1100_XMC2GO) || defined(XMC1100_H_BRIDGE2GO)
-		#undef PIN_SPI_EN
-		#define PIN_SPI_EN    8           /*!< TLE5012 Sensor2Go Kit has a switch on/off pin */
-	#endif
+	return (begin(NULL));
+}
 
+/**
+ * @brief begin method with a fast boot check of the configuration.
+ * The CRC block 08 - 0F is read once and compared with the image, only
+ * differing registers are written and the CRC of 0F is calculated from
+ * the image, so there is no CRC update cycle. The slave number is
+ * only written if STAT holds another one, so a warm boot with an
+ * unchanged configuration needs no write at all.
+ *
+ * @param configImage  expected values of the registers 08 - 0F, NULL only checks the CRC
+ * @return errorTypes
+ */
+errorTypes Tle5012Ino::begin(const uint16_t configImage[])
+{
 	// init helper libs
 	sBus->init();
 	if (PIN_SPI_EN != UNUSED_PIN) {
-		Tle5012b::en = new GPIOIno(PIN_SPI_EN, OUTPUT, GPIOIno::POSITIVE);
+		Tle5012b::en = &enPin;
 		Tle5012b::en->init();
 	}else{
 		Tle5012b::en = NULL;
 	}
 	// start sensor
 	enableSensor();
-	writeSlaveNumber(Tle5012b::mSlave);
+	applySlaveNumber(Tle5012b::mSlave);
+	if (configImage != NULL)
+	{
+		// fast boot, only registers which differ from the image are written
+		return (applyConfigBlock(configImage));
+	}
 	// initial CRC check, should be = 0
 	return (readBlockCRC());
 }
@@ -52,7 +52,16 @@ class Tle5012Ino: virtual public Tle5012b
 					Tle5012Ino();
 					Tle5012Ino(uint8_t csPin, slaveNum slave=TLE5012B_S0);
 					Tle5012Ino(SPIClass3W &bus, uint8_t csPin, uint8_t misoPin, uint8_t mosiPin, uint8_t sckPin, slaveNum slave=TLE5012B_S0);
+					~Tle5012Ino();
+					Tle5012Ino(const Tle5012Ino &) = delete;   //!< sBus and en point into this object, a copy would share them
+		Tle5012Ino &operator=(const Tle5012Ino &) = delete;
 		errorTypes  begin();
+		errorTypes  begin(const uint16_t configImage[]);
+
+	private:
+
+		SPICIno     spic;                 //!< SPI cover of this sensor, no heap allocation
+		GPIOIno     enPin;                //!< Sensor2go enable pin, only used if PIN_SPI_EN is set
 
 };
 
@@ -0,0 +1,166 @@
+/**
+ * @file        capture-arduino.cpp
+ * @brief       Arduino PAL for the edge capture
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "capture-arduino.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
+
+/**
+ * @addtogroup arduinoPal
+ * @{
+ */
+
+CaptureIno *CaptureIno::active = NULL;
+
+/**
+ * @brief Capture Arduino Class Constructor
+ *
+ * @param[in]   pinA    pin connected to IFA
+ * @param[in]   pinB    pin connected to IFB, CAPTURE_UNUSED_PIN for a single input
+ * @param[in]   pinC    pin connected to IFC, CAPTURE_UNUSED_PIN if not needed
+ */
+CaptureIno::CaptureIno(uint8_t pinA, uint8_t pinB, uint8_t pinC):
+	callback(NULL),
+	arg(NULL)
+{
+	pin[0] = pinA;
+	pin[1] = pinB;
+	pin[2] = pinC;
+}
+
+/**
+ * @brief Capture Arduino Class Destructor
+ */
+CaptureIno::~CaptureIno()
+{
+	deinit();
+}
+
+/**
+ * @brief Capture Arduino Class Initialization
+ *
+ * @param[in]   callback  edge callback, called from the interrupt handler
+ * @param[in]   arg       user argument of the callback
+ * @return      CaptureIno::Error_t, ERROR if a pin has no external interrupt
+ */
+CaptureIno::Error_t CaptureIno::init(EdgeCallback_t callback, void *arg)
+{
+	if ((active != NULL) && (active != this))
+	{
+		return ERROR;
+	}
+#ifdef NOT_AN_INTERRUPT
+	// all pins are checked before the first interrupt is attached
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		if ((pin[i] != CAPTURE_UNUSED_PIN) && (digitalPinToInterrupt(pin[i]) == NOT_AN_INTERRUPT))
+		{
+			return ERROR;
+		}
+	}
+#endif
+	this->callback = callback;
+	this->arg = arg;
+	active = this;
+	pinMode(pin[0], INPUT);
+	attachInterrupt(digitalPinToInterrupt(pin[0]), isrA, CHANGE);
+	if (pin[1] != CAPTURE_UNUSED_PIN)
+	{
+		pinMode(pin[1], INPUT);
+		attachInterrupt(digitalPinToInterrupt(pin[1]), isrB, CHANGE);
+	}
+	if (pin[2] != CAPTURE_UNUSED_PIN)
+	{
+		pinMode(pin[2], INPUT);
+		attachInterrupt(digitalPinToInterrupt(pin[2]), isrC, CHANGE);
+	}
+	return OK;
+}
+
+/**
+ * @brief Capture Arduino Class Deinitialization
+ *
+ * @return      CaptureIno::Error_t
+ */
+CaptureIno::Error_t CaptureIno::deinit()
+{
+	if (active == this)
+	{
+		detachInterrupt(digitalPinToInterrupt(pin[0]));
+		if (pin[1] != CAPTURE_UNUSED_PIN)
+		{
+			detachInterrupt(digitalPinToInterrupt(pin[1]));
+		}
+		if (pin[2] != CAPTURE_UNUSED_PIN)
+		{
+			detachInterrupt(digitalPinToInterrupt(pin[2]));
+		}
+		active = NULL;
+	}
+	return OK;
+}
+
+/**
+ * @brief Reads the input level
+ *
+ * @param[in]   channel   0 = IFA, 1 = IFB, 2 = IFC
+ * @return      true for high level
+ */
+bool CaptureIno::level(uint8_t channel)
+{
+	if ((channel > 2) || (pin[channel] == CAPTURE_UNUSED_PIN))
+	{
+		return false;
+	}
+	return (digitalRead(pin[channel]) == HIGH);
+}
+
+/**
+ * @brief Actual time in microseconds
+ */
+uint32_t CaptureIno::now()
+{
+	return micros();
+}
+
+/**
+ * @brief Timestamps are microseconds
+ */
+uint32_t CaptureIno::tickRate()
+{
+	return 1000000UL;
+}
+
+void CaptureIno::isrA()
+{
+	if ((active != NULL) && (active->callback != NULL))
+	{
+		active->callback(0, digitalRead(active->pin[0]) == HIGH, micros(), active->arg);
+	}
+}
+
+void CaptureIno::isrB()
+{
+	if ((active != NULL) && (active->callback != NULL))
+	{
+		active->callback(1, digitalRead(active->pin[1]) == HIGH, micros(), active->arg);
+	}
+}
+
+void CaptureIno::isrC()
+{
+	if ((active != NULL) && (active->callback != NULL))
+	{
+		active->callback(2, digitalRead(active->pin[2]) == HIGH, micros(), active->arg);
+	}
+}
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
@@ -0,0 +1,62 @@
+/**
+ * @file        capture-arduino.hpp
+ * @brief       Arduino PAL for the edge capture
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CAPTURE_ARDUINO_HPP_
+#define CAPTURE_ARDUINO_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
+
+#include <Arduino.h>
+#include "../../../pal/capture.hpp"
+
+/**
+ * @addtogroup arduinoPal
+ * @{
+ */
+
+#define CAPTURE_UNUSED_PIN    0xFF    //!< pin number of an unused channel
+
+/**
+ * @brief Arduino Capture class
+ *
+ * All used pins need an external interrupt, the edges are timestamped with micros().
+ * Set pinB to CAPTURE_UNUSED_PIN for single wire interfaces like PWM,
+ * pinC is only needed for the three hall outputs of HSM.
+ * As attachInterrupt has no user argument, only one instance can be active.
+ * The microsecond timestamps are too coarse for the 1.5 to 3.0 µs unit time
+ * of SPC, Tle5012bSPC needs a timer input capture.
+ */
+class CaptureIno: virtual public Capture
+{
+	public:
+					CaptureIno(uint8_t pinA, uint8_t pinB=CAPTURE_UNUSED_PIN, uint8_t pinC=CAPTURE_UNUSED_PIN);
+					~CaptureIno();
+		Error_t     init(EdgeCallback_t callback, void *arg);
+		Error_t     deinit();
+		bool        level(uint8_t channel);
+		uint32_t    now();
+		uint32_t    tickRate();
+
+	private:
+		uint8_t         pin[3];      //<! \brief IFA, IFB and IFC input pins
+		EdgeCallback_t  callback;    //<! \brief edge callback
+		void            *arg;        //<! \brief edge callback argument
+
+		static CaptureIno *active;   //<! \brief instance of the interrupt handlers
+
+		static void     isrA();
+		static void     isrB();
+		static void     isrC();
+};
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** CAPTURE_ARDUINO_HPP_ **/
@@ -13,6 +13,10 @@
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_ARDUINO)
 #if (SPI3W_INO == SPI3W_ARD)
 
+#if defined(SPI3W_FAST_IO)
+	#include <util/atomic.h>
+#endif
+
 /**
  * @addtogroup arduinoPal
  * @{
@@ -20,6 +24,11 @@
  * @brief Arduino SPIClass extension to use 3wire SSC SPI interfaces
  */
 
+/**
+ * @brief Default 3wire SPI channel, statically allocated
+ */
+SPIClass3W SPI3W;
+
 /**
  * @brief Construct a new SPIClass3W::SPIClass3W object
  * 
@@ -31,6 +40,12 @@ SPIClass3W::SPIClass3W():SPIClass()
 	this->mMOSI = PIN_SPI_MOSI;
 	this->mSCK = PIN_SPI_SCK;
 	this->mSpiNum = 0;
+	this->mSpeed = SPEED;
+	this->mKeepTransaction = false;
+	this->mInTransaction = false;
+	#if defined(SPI3W_FAST_IO)
+		cachePins();
+	#endif
 }
 
 /**
@@ -58,6 +73,12 @@ void SPIClass3W::begin(uint8_t miso, uint8_t mosi, uint8_t sck, uint8_t cs)
 	pinMode(this->mCS,OUTPUT);
 	digitalWrite(this->mCS, HIGH);
 	SPIClass::begin();
+	#if defined(SPI3W_FAST_IO)
+		// no pull up on the shared data line while it is an input
+		digitalWrite(this->mMISO, LOW);
+		digitalWrite(this->mMOSI, LOW);
+		cachePins();
+	#endif
 }
 
 /*!
@@ -68,7 +89,80 @@ void SPIClass3W::begin(uint8_t miso, uint8_t mosi, uint8_t sck, uint8_t cs)
  */
 void SPIClass3W::setCSPin(uint8_t cs)
 {
-	this->mCS = cs;
+	#if defined(SPI3W_FAST_IO)
+		if (cs != this->mCS)
+		{
+			this->mCS = cs;
+			cachePins();
+		}
+	#else
+		this->mCS = cs;
+	#endif
+}
+
+#if defined(SPI3W_FAST_IO)
+/*!
+ * @brief Fetches the port registers and bit masks of chipselect, miso and mosi,
+ * so that a frame needs only single register writes for them
+ */
+void SPIClass3W::cachePins()
+{
+	this->mCSOut    = portOutputRegister(digitalPinToPort(this->mCS));
+	this->mCSMask   = digitalPinToBitMask(this->mCS);
+	this->mMISODir  = portModeRegister(digitalPinToPort(this->mMISO));
+	this->mMISOMask = digitalPinToBitMask(this->mMISO);
+	this->mMOSIDir  = portModeRegister(digitalPinToPort(this->mMOSI));
+	this->mMOSIMask = digitalPinToBitMask(this->mMOSI);
+}
+#endif
+
+/*!
+ * @brief Set the SPI clock frequency, used with the next transfer
+ *
+ * @param speed [in] clock frequency in Hz, the SPI library selects the next lower possible divider
+ */
+void SPIClass3W::setSpeed(uint32_t speed)
+{
+	this->mSpeed = speed;
+	releaseTransaction();
+}
+
+/*!
+ * @brief Returns the requested SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPIClass3W::getSpeed()
+{
+	return this->mSpeed;
+}
+
+/*!
+ * @brief Keeps the SPI transaction open between frames, which saves the
+ * transaction setup for back to back reads. Use it only if no other device
+ * shares the SPI bus, as the transaction settings are not applied again.
+ *
+ * @param keep [in] true keeps the transaction open, false closes it after each frame
+ */
+void SPIClass3W::setKeepTransaction(bool keep)
+{
+	this->mKeepTransaction = keep;
+	if (!keep)
+	{
+		releaseTransaction();
+	}
+}
+
+/*!
+ * @brief Closes a kept open SPI transaction
+ */
+void SPIClass3W::releaseTransaction()
+{
+	if (this->mInTransaction)
+	{
+		endTransaction();
+		this->mInTransaction = false;
+	}
 }
 
 /*!
@@ -83,10 +177,23 @@ void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data,
 {
 	uint32_t data_index = 0;
 	//send via TX
-	pinMode(this->mMISO,INPUT);
-	pinMode(this->mMOSI,OUTPUT);
-	digitalWrite(this->mCS, LOW);
-	beginTransaction(SPISettings(SPEED,MSBFIRST,SPI_MODE1));
+	#if defined(SPI3W_FAST_IO)
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			*this->mMISODir &= ~this->mMISOMask;
+			*this->mMOSIDir |= this->mMOSIMask;
+			*this->mCSOut &= ~this->mCSMask;
+		}
+	#else
+		pinMode(this->mMISO,INPUT);
+		pinMode(this->mMOSI,OUTPUT);
+		digitalWrite(this->mCS, LOW);
+	#endif
+	if (!this->mInTransaction)
+	{
+		beginTransaction(SPISettings(this->mSpeed,MSBFIRST,SPI_MODE1));
+		this->mInTransaction = true;
+	}
 
 	for(data_index = 0; data_index < size_of_sent_data; data_index++)
 	{
@@ -94,16 +201,35 @@ void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data,
 	}
 
 	// receive via RX
-	pinMode(this->mMISO,OUTPUT);
-	pinMode(this->mMOSI,INPUT);
+	#if defined(SPI3W_FAST_IO)
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			*this->mMISODir |= this->mMISOMask;
+			*this->mMOSIDir &= ~this->mMOSIMask;
+		}
+	#else
+		pinMode(this->mMISO,OUTPUT);
+		pinMode(this->mMOSI,INPUT);
+	#endif
 	delayMicroseconds(5);
 
 	for(data_index = 0; data_index < size_of_received_data; data_index++)
 	{
 		received_data[data_index] = transfer16(0x0000);
 	}
-	endTransaction();
-	digitalWrite(this->mCS, HIGH);
+	if (!this->mKeepTransaction)
+	{
+		endTransaction();
+		this->mInTransaction = false;
+	}
+	#if defined(SPI3W_FAST_IO)
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			*this->mCSOut |= this->mCSMask;
+		}
+	#else
+		digitalWrite(this->mCS, HIGH);
+	#endif
 }
 
 /** @} */
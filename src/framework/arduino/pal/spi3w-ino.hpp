@@ -37,6 +37,14 @@
 #define SPI3W_XMC     2
 
 #define MAX_SLAVE_NUM    4              //!< Maximum numbers of slaves on one SPI bus
+
+#ifndef SPI3W_XMC_TXFIFO_OFFSET
+#define SPI3W_XMC_TXFIFO_OFFSET  32U    //!< XMC USIC FIFO buffer offset of the transmit FIFO, 0 - 31 are left for the serial
+#endif
+#ifndef SPI3W_XMC_RXFIFO_OFFSET
+#define SPI3W_XMC_RXFIFO_OFFSET  48U    //!< XMC USIC FIFO buffer offset of the receive FIFO
+#endif
+#define SPI3W_XMC_FIFO_WORDS     16U    //!< XMC USIC transmit and receive FIFO size, a full burst with safety word
 #define SPEED            1000000U       //!< default speed of SPI transfer
 
 class SPIClass3W : public SPIClass
@@ -49,6 +57,10 @@ class SPIClass3W : public SPIClass
 			#define SPI3W_INO SPI3W_ARD
 		#endif
 
+		#if (SPI3W_INO == SPI3W_ARD) && defined(ARDUINO_ARCH_AVR)
+			#define SPI3W_FAST_IO    //!< direct port register access for chipselect and data line direction
+		#endif
+
 
 		uint8_t     mCS;                //!< Pin for chip select
 		uint8_t     mSpiNum;            //!< Number of used SPI channel
@@ -58,14 +70,33 @@ class SPIClass3W : public SPIClass
 		void    begin(uint8_t miso, uint8_t mosi, uint8_t sck, uint8_t cs);
 		void    setCSPin(uint8_t cs);
 		void    sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		void    setSpeed(uint32_t speed);
+		uint32_t getSpeed();
+		void    setKeepTransaction(bool keep);
+		void    releaseTransaction();
 
 	private:
 
+		uint32_t    mSpeed;              //!< SPI clock frequency in Hz
+		bool        mKeepTransaction;    //!< keep the SPI transaction open between frames
+		bool        mInTransaction;      //!< SPI transaction is open
+
 		uint8_t     mMOSI;               //!< Pin for SPI MOSI
 		uint8_t     mMISO;               //!< Pin for SPI MISO
 		uint8_t     mSCK;                //!< Pin for SPI System Clock
 
 
+		#if defined(SPI3W_FAST_IO)
+			volatile uint8_t *mCSOut;    //!< output register of the chipselect pin
+			volatile uint8_t *mMISODir;  //!< direction register of the miso pin
+			volatile uint8_t *mMOSIDir;  //!< direction register of the mosi pin
+			uint8_t     mCSMask;         //!< bit mask of the chipselect pin
+			uint8_t     mMISOMask;       //!< bit mask of the miso pin
+			uint8_t     mMOSIMask;       //!< bit mask of the mosi pin
+
+			void cachePins();            //!< fetch port registers and masks of all pins
+		#endif
+
 		#if defined(UC_FAMILY) && (UC_FAMILY == 1 || UC_FAMILY == 4)
 			/*!
 			* The enhanced 3-Wire parameter structure includes miso/mosi open and close
@@ -92,6 +123,7 @@ class SPIClass3W : public SPIClass
 
 			void setupSPI();             //!< initial 3-Wire SPI setup
 			void initSpi();              //!< initial startup of the 3-Wire SPI interface
+			void fifoTransfer(const uint16_t *sent_data, uint16_t *received_data, uint16_t size); //!< FIFO burst of up to SPI3W_XMC_FIFO_WORDS words per chunk
 		#endif
 };
 
@@ -32,6 +32,10 @@ SPIClass3W::SPIClass3W()
 	this->mMOSI = PIN_SPI_MOSI;
 	this->mSCK = PIN_SPI_SCK;
 	this->mSpiNum = 0;
+	this->mSpeed = SPEED;
+	this->mKeepTransaction = false;
+	this->mInTransaction = false;
+	m3Wire.channel = NULL;
 }
 
 /**
@@ -88,7 +92,7 @@ void SPIClass3W::setupSPI()
 	m3Wire.mosi_close.mode = XMC_GPIO_MODE_INPUT_TRISTATE;
 
 	m3Wire.sck_config.output_level = XMC_GPIO_OUTPUT_LEVEL_HIGH;
-	m3Wire.channel_config.baudrate = SPEED;
+	m3Wire.channel_config.baudrate = this->mSpeed;
 	m3Wire.channel_config.bus_mode = (XMC_SPI_CH_BUS_MODE_t)XMC_SPI_CH_BUS_MODE_MASTER;
 	m3Wire.channel_config.selo_inversion = XMC_SPI_CH_SLAVE_SEL_INV_TO_MSLS;
 	m3Wire.channel_config.parity_mode = XMC_USIC_CH_PARITY_MODE_NONE;
@@ -161,11 +165,99 @@ void SPIClass3W::initSpi()
 	XMC_SPI_CH_SetBaudrate(m3Wire.channel, (uint32_t)m3Wire.channel_config.baudrate);
 	XMC_SPI_CH_SetBitOrderMsbFirst(m3Wire.channel);
 
+	XMC_USIC_CH_TXFIFO_Configure(m3Wire.channel, SPI3W_XMC_TXFIFO_OFFSET, XMC_USIC_CH_FIFO_SIZE_16WORDS, 1U);
+	XMC_USIC_CH_RXFIFO_Configure(m3Wire.channel, SPI3W_XMC_RXFIFO_OFFSET, XMC_USIC_CH_FIFO_SIZE_16WORDS, 0U);
+
 	XMC_SPI_CH_Start(m3Wire.channel);
 
 	XMC_GPIO_Init(m3Wire.sck.port, m3Wire.sck.pin, &m3Wire.sck_config);
 	XMC_GPIO_Init(m3Wire.cs.port, m3Wire.cs.pin, &m3Wire.cs_config);
 	XMC_GPIO_SetOutputLevel( m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_HIGH);
+
+	// full pin setup once, a frame only switches the mosi mode
+	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_open);
+	XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_close);
+}
+
+/*!
+ * @brief Set the SPI clock frequency. If the USIC channel is already
+ * running, the new baudrate is set immediately.
+ *
+ * @param speed [in] clock frequency in Hz
+ */
+void SPIClass3W::setSpeed(uint32_t speed)
+{
+	this->mSpeed = speed;
+	m3Wire.channel_config.baudrate = speed;
+	if (m3Wire.channel != NULL)
+	{
+		XMC_SPI_CH_SetBaudrate(m3Wire.channel, speed);
+	}
+}
+
+/*!
+ * @brief Returns the requested SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPIClass3W::getSpeed()
+{
+	return this->mSpeed;
+}
+
+/*!
+ * @brief The XMC variant drives the USIC channel directly without
+ * SPI transactions, so there is nothing to keep open
+ *
+ * @param keep [in] stored only
+ */
+void SPIClass3W::setKeepTransaction(bool keep)
+{
+	this->mKeepTransaction = keep;
+}
+
+/*!
+ * @brief No SPI transaction is used on XMC
+ */
+void SPIClass3W::releaseTransaction()
+{
+	this->mInTransaction = false;
+}
+
+/*!
+ * @brief Queues up to SPI3W_XMC_FIFO_WORDS words in the transmit FIFO at once and
+ * drains the receive FIFO once all of them are shifted. The CPU waits for the
+ * FIFO level of a whole chunk instead of polling each word.
+ *
+ * @param sent_data [in] words to send, NULL sends zero words
+ * @param received_data [out] received words, one for each sent word, NULL discards them
+ * @param size [in] number of words
+ */
+void SPIClass3W::fifoTransfer(const uint16_t *sent_data, uint16_t *received_data, uint16_t size)
+{
+	uint16_t done = 0;
+	while (done < size)
+	{
+		uint16_t chunk = size - done;
+		if (chunk > SPI3W_XMC_FIFO_WORDS)
+		{
+			chunk = SPI3W_XMC_FIFO_WORDS;
+		}
+		for (uint16_t i = 0; i < chunk; i++)
+		{
+			XMC_SPI_CH_Transmit(m3Wire.channel, (sent_data != NULL) ? sent_data[done + i] : 0x0000, XMC_SPI_CH_MODE_STANDARD);
+		}
+		while (XMC_USIC_CH_RXFIFO_GetLevel(m3Wire.channel) < chunk);
+		for (uint16_t i = 0; i < chunk; i++)
+		{
+			uint16_t data = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
+			if (received_data != NULL)
+			{
+				received_data[done + i] = data;
+			}
+		}
+		done += chunk;
+	}
 }
 
 /*!
@@ -178,34 +270,19 @@ void SPIClass3W::initSpi()
  */
 void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
 {
-	uint32_t data_index = 0;
-	//send via TX
-	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_close);
-	XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_open);
+	//send via TX, miso is tristate input in both directions
+	XMC_USIC_CH_RXFIFO_Flush(m3Wire.channel);
+	XMC_GPIO_SetMode(m3Wire.mosi.port, m3Wire.mosi.pin, m3Wire.mosi_open.mode);
 	XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_LOW);
 
-	for(data_index = 0; data_index < size_of_sent_data; data_index++)
-	{
-		XMC_SPI_CH_Transmit(m3Wire.channel, sent_data[data_index], XMC_SPI_CH_MODE_STANDARD);
-		while((XMC_SPI_CH_GetStatusFlag(m3Wire.channel) & XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION) == 0U);
-		XMC_SPI_CH_ClearStatusFlag(m3Wire.channel, XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION);
-		while (XMC_USIC_CH_GetReceiveBufferStatus(m3Wire.channel) == 0U);
-		received_data[0] = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
-	}
+	// the words read back while sending are only the echo of the command
+	fifoTransfer(sent_data, NULL, size_of_sent_data);
 
 	// receive via RX
-	XMC_GPIO_Init(m3Wire.miso.port, m3Wire.miso.pin, &m3Wire.miso_open);
-	XMC_GPIO_Init(m3Wire.mosi.port, m3Wire.mosi.pin, &m3Wire.mosi_close);
+	XMC_GPIO_SetMode(m3Wire.mosi.port, m3Wire.mosi.pin, m3Wire.mosi_close.mode);
 	delayMicroseconds(5);
 
-	for(data_index = 0; data_index < size_of_received_data; data_index++)
-	{
-		XMC_SPI_CH_Transmit(m3Wire.channel, 0x0000, XMC_SPI_CH_MODE_STANDARD);
-		while((XMC_SPI_CH_GetStatusFlag(m3Wire.channel) & XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION) == 0U);
-		XMC_SPI_CH_ClearStatusFlag(m3Wire.channel, XMC_SPI_CH_STATUS_FLAG_TRANSMIT_SHIFT_INDICATION);
-		while (XMC_USIC_CH_GetReceiveBufferStatus(m3Wire.channel) == 0U);
-		received_data[data_index] = XMC_SPI_CH_GetReceivedData(m3Wire.channel);
-	}
+	fifoTransfer(NULL, received_data, size_of_received_data);
 
 	XMC_GPIO_SetOutputLevel(m3Wire.cs.port, m3Wire.cs.pin,XMC_GPIO_OUTPUT_LEVEL_HIGH);
 }
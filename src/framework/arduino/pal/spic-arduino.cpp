@@ -31,6 +31,8 @@ SPICIno::SPICIno(uint8_t csPin)
 	this->csPin = csPin;
 	#if defined(UC_FAMILY) && (UC_FAMILY == 1 || UC_FAMILY == 4)
 		this->spi =&SPI;
+	#else
+		this->spi =&SPI3W;
 	#endif
 }
 
@@ -81,7 +83,7 @@ SPICIno::Error_t SPICIno::init()
  */
 SPICIno::Error_t SPICIno::deinit()
 {
-	this->spi->endTransaction();
+	this->spi->releaseTransaction();
 	this->spi->end();
 	return OK;
 }
@@ -119,6 +121,28 @@ SPICIno::Error_t SPICIno::sendReceive(uint16_t* sent_data, uint16_t size_of_sent
 	return OK;
 }
 
+/**
+ * @brief Sets the SPI clock frequency
+ *
+ * @param speed clock frequency in Hz
+ * @return SPICIno::Error_t
+ */
+SPICIno::Error_t SPICIno::setClock(uint32_t speed)
+{
+	this->spi->setSpeed(speed);
+	return OK;
+}
+
+/**
+ * @brief Returns the SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPICIno::getClock()
+{
+	return this->spi->getSpeed();
+}
+
 /** @} */
 
 #endif /** TLE5012_FRAMEWORK **/
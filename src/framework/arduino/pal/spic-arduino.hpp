@@ -48,6 +48,8 @@ class SPICIno: virtual public SPIC
 		Error_t     deinit();
 		Error_t     triggerUpdate();
 		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     setClock(uint32_t speed);
+		uint32_t    getClock();
 
 };
 
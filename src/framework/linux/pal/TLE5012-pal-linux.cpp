@@ -0,0 +1,100 @@
+/** 
+ * @file        TLE5012-pal-linux.cpp
+ * @brief       TLE5012 Linux spidev Hardware Platforms
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ * 
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "TLE5012-pal-linux.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+
+/**
+ * @addtogroup linuxPal
+ */
+
+/**
+ * @brief Construct a new Tle5012Linux::Tle5012Linux object with the chipselect
+ * of the SPI controller and SPI_3WIRE mode. triggerUpdate is not available.
+ *
+ * @param device   spidev device node
+ * @param slave    optional sensor slave setting
+ */
+Tle5012Linux::Tle5012Linux(const char *device, slaveNum slave):Tle5012b(),
+	spic(device, true)
+{
+	Tle5012b::mSlave = slave;
+	Tle5012b::sBus = &spic;
+}
+
+/**
+ * @brief Construct a new Tle5012Linux::Tle5012Linux object with a GPIO chipselect
+ *
+ * @param device     spidev device node
+ * @param threeWire  use the SPI_3WIRE mode of the controller
+ * @param gpioChip   GPIO character device of the chipselect, e.g. /dev/gpiochip0
+ * @param csLine     line offset of the chipselect
+ * @param slave      optional sensor slave setting
+ */
+Tle5012Linux::Tle5012Linux(const char *device, bool threeWire, const char *gpioChip, uint32_t csLine, slaveNum slave):Tle5012b(),
+	spic(device, threeWire, gpioChip, csLine)
+{
+	Tle5012b::mSlave = slave;
+	Tle5012b::sBus = &spic;
+}
+
+/**
+ * @brief Destroy the Tle5012Linux::Tle5012Linux object
+ * The SPI cover is a member and is gone before the base destructor runs,
+ * so the bus is released here.
+ */
+Tle5012Linux::~Tle5012Linux()
+{
+	end();
+	Tle5012b::sBus = NULL;
+}
+
+/**
+ * @brief begin method opens the spidev device and checks the sensor
+ *
+ * @return errorTypes, INTERFACE_ACCESS_ERROR if the device can not be opened
+ */
+errorTypes Tle5012Linux::begin(void)
+{
+	return (begin(NULL));
+}
+
+/**
+ * @brief begin method with a fast boot check of the configuration.
+ * The CRC block 08 - 0F is read once and compared with the image, only
+ * differing registers are written and the CRC of 0F is calculated from
+ * the image, so there is no CRC update cycle. The slave number is
+ * only written if STAT holds another one, so a warm boot with an
+ * unchanged configuration needs no write at all.
+ *
+ * @param configImage  expected values of the registers 08 - 0F, NULL only checks the CRC
+ * @return errorTypes
+ */
+errorTypes Tle5012Linux::begin(const uint16_t configImage[])
+{
+	if (sBus->init() != SPIC::OK)
+	{
+		return (INTERFACE_ACCESS_ERROR);
+	}
+	Tle5012b::en = NULL;
+	// start sensor
+	enableSensor();
+	applySlaveNumber(Tle5012b::mSlave);
+	if (configImage != NULL)
+	{
+		// fast boot, only registers which differ from the image are written
+		return (applyConfigBlock(configImage));
+	}
+	// initial CRC check, should be = 0
+	return (readBlockCRC());
+}
+
+#endif /** TLE5012_FRAMEWORK **/
+/** @} */
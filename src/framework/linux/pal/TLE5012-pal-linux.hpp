@@ -0,0 +1,64 @@
+/*!
+ * \file        TLE5012-pal-linux.hpp
+ * \name        TLE5012-pal-linux.hpp - Linux spidev Hardware Abstraction Layer
+ * \author      Infineon Technologies AG
+ * \copyright   2020 Infineon Technologies AG
+ * \version     3.1.0
+ * \ref         linuxPal
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef TLE5012_PAL_LINUX_HPP_
+#define TLE5012_PAL_LINUX_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+
+/**
+ * @addtogroup linuxPal
+ *
+ * @{
+ */
+
+#include "../../../corelib/TLE5012b.hpp"
+#include "spic-linux.hpp"
+
+/**
+ * @brief represents a basic TLE5012b Linux class.
+ *
+ * This class connects the sensor to a spidev device of an embedded Linux,
+ * e.g. /dev/spidev0.0. The SPI controller must support SPI_3WIRE for the shared
+ * data line, otherwise MISO and MOSI are connected via a resistor like on the
+ * Sensor2go kit and threeWire is set false.
+ *
+ * @see Tle5012
+ */
+
+class Tle5012Linux: virtual public Tle5012b
+{
+
+	public:
+
+					Tle5012Linux(const char *device="/dev/spidev0.0", slaveNum slave=TLE5012B_S0);
+					Tle5012Linux(const char *device, bool threeWire, const char *gpioChip, uint32_t csLine, slaveNum slave=TLE5012B_S0);
+					~Tle5012Linux();
+					Tle5012Linux(const Tle5012Linux &) = delete;   //!< sBus points into this object, a copy would share it
+		Tle5012Linux &operator=(const Tle5012Linux &) = delete;
+		errorTypes  begin();
+		errorTypes  begin(const uint16_t configImage[]);
+
+	private:
+
+		SPICLinux   spic;                 //!< SPI cover of this sensor, no heap allocation
+
+};
+
+/**
+ * @}
+ */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** TLE5012_PAL_LINUX_HPP_ **/
@@ -0,0 +1,140 @@
+/**
+ * @file        semaphore-linux.cpp
+ * @brief       Linux POSIX Semaphore PAL
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "semaphore-linux.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+
+#include <errno.h>
+#include <time.h>
+
+/**
+ * @addtogroup linuxPal
+ * @{
+ */
+
+/**
+ * @brief Constructor of the Linux Semaphore class
+ *
+ */
+SemaphoreLinux::SemaphoreLinux():
+	initialized(false)
+{
+}
+
+/**
+ * @brief Destructor of the Linux Semaphore class
+ *
+ */
+SemaphoreLinux::~SemaphoreLinux()
+{
+	deinit();
+}
+
+/**
+ * @brief Initialization of the Semaphore with a count of zero
+ *
+ * @return      SemaphoreLinux::Error_t
+ */
+SemaphoreLinux::Error_t SemaphoreLinux::init()
+{
+	if (this->initialized)
+	{
+		return OK;
+	}
+	if (sem_init(&this->semaphore, 0, 0) != 0)
+	{
+		return ERROR;
+	}
+	this->initialized = true;
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the Semaphore
+ *
+ * @return      SemaphoreLinux::Error_t
+ */
+SemaphoreLinux::Error_t SemaphoreLinux::deinit()
+{
+	if (!this->initialized)
+	{
+		return OK;
+	}
+	this->initialized = false;
+	if (sem_destroy(&this->semaphore) != 0)
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+/**
+ * @brief Take the Semaphore
+ *
+ * The calling thread sleeps until the semaphore is given
+ * or the timeout has passed. Signals do not end the wait.
+ *
+ * @param[in]   timeout Timeout in milliseconds
+ * @return      SemaphoreLinux::Error_t
+ */
+SemaphoreLinux::Error_t SemaphoreLinux::take(uint32_t timeout)
+{
+	int ret;
+
+	if (!this->initialized)
+	{
+		return ERROR;
+	}
+	if (timeout == SEMAPHORE_WAIT_FOREVER)
+	{
+		do
+		{
+			ret = sem_wait(&this->semaphore);
+		} while ((ret != 0) && (errno == EINTR));
+		return (ret == 0) ? OK : ERROR;
+	}
+
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += timeout / 1000;
+	deadline.tv_nsec += (long) (timeout % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+	do
+	{
+		ret = sem_timedwait(&this->semaphore, &deadline);
+	} while ((ret != 0) && (errno == EINTR));
+	if (ret == 0)
+	{
+		return OK;
+	}
+	return (errno == ETIMEDOUT) ? TIMEOUT : ERROR;
+}
+
+/**
+ * @brief Give the Semaphore
+ *
+ * @return      SemaphoreLinux::Error_t
+ */
+SemaphoreLinux::Error_t SemaphoreLinux::give()
+{
+	if (!this->initialized || (sem_post(&this->semaphore) != 0))
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
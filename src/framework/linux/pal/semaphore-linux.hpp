@@ -0,0 +1,48 @@
+/**
+ * @file        semaphore-linux.hpp
+ * @brief       Linux POSIX Semaphore PAL
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SEMAPHORE_LINUX_HPP_
+#define SEMAPHORE_LINUX_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+
+#include "../../../pal/semaphore.hpp"
+#include <semaphore.h>
+
+/**
+ * @addtogroup linuxPal
+ * @{
+ */
+
+/**
+ * @brief Linux Semaphore class
+ *
+ * Unnamed POSIX semaphore shared between the threads of one process.
+ */
+class SemaphoreLinux: virtual public Semaphore
+{
+	public:
+		SemaphoreLinux();
+		~SemaphoreLinux();
+		Error_t init();
+		Error_t deinit();
+		Error_t take(uint32_t timeout);
+		Error_t give();
+
+	private:
+		sem_t   semaphore;      //<! \brief POSIX semaphore
+		bool    initialized;    //<! \brief sem_init done
+};
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** SEMAPHORE_LINUX_HPP_ **/
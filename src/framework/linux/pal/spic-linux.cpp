@@ -0,0 +1,305 @@
+/**
+ * @file        spic-linux.cpp
+ * @brief       Linux spidev PAL for the SPI cover
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "spic-linux.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include <linux/spi/spidev.h>
+
+/**
+ * @addtogroup linuxPal
+ * @{
+ */
+
+static int sysOpen(const char *path, int flags)
+{
+	return open(path, flags);
+}
+
+static int sysClose(int fd)
+{
+	return close(fd);
+}
+
+static int sysIoctl(int fd, unsigned long request, void *arg)
+{
+	return ioctl(fd, request, arg);
+}
+
+const SPICLinux::Backend_t SPICLinux::defaultBackend = { sysOpen, sysClose, sysIoctl };
+
+/**
+ * @brief Construct a new SPICLinux::SPICLinux object with the
+ * chipselect of the SPI controller. triggerUpdate is not available.
+ *
+ * @param device     spidev device node
+ * @param threeWire  use the SPI_3WIRE mode of the controller for a shared data line
+ */
+SPICLinux::SPICLinux(const char *device, bool threeWire):
+	device(device),
+	gpioChip(NULL),
+	csLine(0),
+	threeWire(threeWire),
+	speed(SPI_SPEED_DEFAULT),
+	spiFd(-1),
+	csFd(-1),
+	backend(defaultBackend)
+{
+}
+
+/**
+ * @brief Construct a new SPICLinux::SPICLinux object with a
+ * chipselect line of a GPIO character device
+ *
+ * @param device     spidev device node
+ * @param threeWire  use the SPI_3WIRE mode of the controller for a shared data line
+ * @param gpioChip   GPIO character device, e.g. /dev/gpiochip0, NULL uses the controller chipselect
+ * @param csLine     line offset of the chipselect on gpioChip
+ * @param backend    system calls, replace for tests without hardware
+ */
+SPICLinux::SPICLinux(const char *device, bool threeWire, const char *gpioChip, uint32_t csLine, const Backend_t &backend):
+	device(device),
+	gpioChip(gpioChip),
+	csLine(csLine),
+	threeWire(threeWire),
+	speed(SPI_SPEED_DEFAULT),
+	spiFd(-1),
+	csFd(-1),
+	backend(backend)
+{
+}
+
+/**
+ * @brief Destructor of the Linux SPIC class
+ *
+ */
+SPICLinux::~SPICLinux()
+{
+	deinit();
+}
+
+/**
+ * @brief Initialize the SPIC
+ *
+ * Opens the spidev node and sets SPI mode 1, 16 bit words and the clock.
+ * If a GPIO chipselect is set, the line is requested as output with high level.
+ *
+ * @return      SPICLinux::Error_t
+ */
+SPICLinux::Error_t SPICLinux::init()
+{
+	uint8_t mode = SPI_MODE_1;
+	uint8_t bits = 16;
+
+	if (this->spiFd >= 0)
+	{
+		return OK;
+	}
+
+	if (this->gpioChip != NULL)
+	{
+		struct gpiohandle_request req;
+		memset(&req, 0, sizeof(req));
+		req.lineoffsets[0] = this->csLine;
+		req.flags = GPIOHANDLE_REQUEST_OUTPUT;
+		req.default_values[0] = 1;
+		req.lines = 1;
+		strncpy(req.consumer_label, "tle5012", sizeof(req.consumer_label) - 1);
+
+		int chipFd = this->backend.open(this->gpioChip, O_RDWR);
+		if (chipFd < 0)
+		{
+			return INTF_ERROR;
+		}
+		int ret = this->backend.ioctl(chipFd, GPIO_GET_LINEHANDLE_IOCTL, &req);
+		this->backend.close(chipFd);
+		if (ret < 0)
+		{
+			return CONF_ERROR;
+		}
+		this->csFd = req.fd;
+		mode |= SPI_NO_CS;
+	}
+
+	if (this->threeWire)
+	{
+		mode |= SPI_3WIRE;
+	}
+
+	this->spiFd = this->backend.open(this->device, O_RDWR);
+	if (this->spiFd < 0)
+	{
+		deinit();
+		return INTF_ERROR;
+	}
+	if ((this->backend.ioctl(this->spiFd, SPI_IOC_WR_MODE, &mode) < 0)
+		|| (this->backend.ioctl(this->spiFd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0)
+		|| (this->backend.ioctl(this->spiFd, SPI_IOC_WR_MAX_SPEED_HZ, &this->speed) < 0))
+	{
+		deinit();
+		return CONF_ERROR;
+	}
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the SPIC
+ *
+ * Closes the spidev node and releases the chipselect line.
+ *
+ * @return      SPICLinux::Error_t
+ */
+SPICLinux::Error_t SPICLinux::deinit()
+{
+	if (this->spiFd >= 0)
+	{
+		this->backend.close(this->spiFd);
+		this->spiFd = -1;
+	}
+	if (this->csFd >= 0)
+	{
+		this->backend.close(this->csFd);
+		this->csFd = -1;
+	}
+	return OK;
+}
+
+/**
+ * @brief Sets the level of the GPIO chipselect line
+ *
+ * @param level   0 = active, 1 = inactive
+ * @return        SPICLinux::Error_t
+ */
+SPICLinux::Error_t SPICLinux::setCS(uint8_t level)
+{
+	struct gpiohandle_data data;
+	memset(&data, 0, sizeof(data));
+	data.values[0] = level;
+	if (this->backend.ioctl(this->csFd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data) < 0)
+	{
+		return INTF_ERROR;
+	}
+	return OK;
+}
+
+/**
+ * @brief
+ * Triggers an update in the register buffer. This function
+ * should be triggered once before UPD registers where read as
+ * it generates a snapshot of the UPD register values at trigger point.
+ * Needs the GPIO chipselect line, as spidev can not pull the
+ * chipselect without clocking.
+ *
+ * @return SPICLinux::Error_t
+ */
+SPICLinux::Error_t SPICLinux::triggerUpdate()
+{
+	struct timespec grace = { 0, SPIC_LINUX_TURNAROUND_US * 1000L };
+
+	if (this->csFd < 0)
+	{
+		return CONF_ERROR;
+	}
+	Error_t err = setCS(0);
+	// grace period for register snapshot
+	nanosleep(&grace, NULL);
+	if (setCS(1) != OK)
+	{
+		err = INTF_ERROR;
+	}
+	return err;
+}
+
+/*!
+* Main SPI three wire communication functions for sending and receiving data.
+* The command words and the read words are one SPI_IOC_MESSAGE with two segments,
+* the transmit segment holds the turnaround delay. spidev handles 16 bit words
+* in native byte order, so the buffers are used without copy.
+* @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
+* @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read
+*/
+SPICLinux::Error_t SPICLinux::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	struct spi_ioc_transfer xfer[2];
+	unsigned int segments = 1;
+	Error_t err = OK;
+
+	if (this->spiFd < 0)
+	{
+		return INTF_ERROR;
+	}
+
+	memset(xfer, 0, sizeof(xfer));
+	xfer[0].tx_buf = (unsigned long) sent_data;
+	xfer[0].len = 2 * size_of_sent_data;
+	xfer[0].speed_hz = this->speed;
+	xfer[0].bits_per_word = 16;
+	xfer[0].delay_usecs = SPIC_LINUX_TURNAROUND_US;
+	if (size_of_received_data > 0)
+	{
+		xfer[1].rx_buf = (unsigned long) received_data;
+		xfer[1].len = 2 * size_of_received_data;
+		xfer[1].speed_hz = this->speed;
+		xfer[1].bits_per_word = 16;
+		segments = 2;
+	}
+
+	if ((this->csFd >= 0) && (setCS(0) != OK))
+	{
+		return INTF_ERROR;
+	}
+	if (this->backend.ioctl(this->spiFd, SPI_IOC_MESSAGE(segments), xfer) < 0)
+	{
+		err = READ_ERROR;
+	}
+	if ((this->csFd >= 0) && (setCS(1) != OK))
+	{
+		err = INTF_ERROR;
+	}
+	return err;
+}
+
+/**
+ * @brief Sets the SPI clock frequency, used with the next message
+ *
+ * @param speed clock frequency in Hz
+ * @return SPICLinux::Error_t
+ */
+SPICLinux::Error_t SPICLinux::setClock(uint32_t speed)
+{
+	if ((this->spiFd >= 0) && (this->backend.ioctl(this->spiFd, SPI_IOC_WR_MAX_SPEED_HZ, &speed) < 0))
+	{
+		return CONF_ERROR;
+	}
+	this->speed = speed;
+	return OK;
+}
+
+/**
+ * @brief Returns the SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPICLinux::getClock()
+{
+	return this->speed;
+}
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
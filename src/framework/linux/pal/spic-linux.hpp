@@ -0,0 +1,79 @@
+/**
+ * @file        spic-linux.hpp
+ * @brief       Linux spidev PAL for the SPI cover
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SPIC_LINUX_HPP_
+#define SPIC_LINUX_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+
+#include "../../../pal/spic.hpp"
+
+/**
+ * @addtogroup linuxPal
+ * @{
+ */
+
+#define SPIC_LINUX_TURNAROUND_US    5U    //!< delay between command and data words for the data line turnaround
+
+/**
+ * @brief Linux SPIC class
+ *
+ * Uses the spidev user space interface. Each 3wire command/response frame is
+ * one SPI_IOC_MESSAGE with a transmit segment, the turnaround delay and a
+ * receive segment. With SPI_3WIRE the SPI controller drives the shared data line
+ * only for the transmit segment. An optional chipselect line of a GPIO character
+ * device (/dev/gpiochipN) is needed for triggerUpdate, in that case the
+ * chipselect of the SPI controller is switched off with SPI_NO_CS.
+ */
+class SPICLinux: virtual public SPIC
+{
+	public:
+
+		/**
+		 * @brief System call backend, replaceable for tests without hardware
+		 */
+		struct Backend_t
+		{
+			int (*open)(const char *path, int flags);                //!< \brief open a device node
+			int (*close)(int fd);                                    //!< \brief close a file descriptor
+			int (*ioctl)(int fd, unsigned long request, void *arg);  //!< \brief device control
+		};
+
+		static const Backend_t defaultBackend;                      //!< \brief libc open, close and ioctl
+
+					SPICLinux(const char *device="/dev/spidev0.0", bool threeWire=true);
+					SPICLinux(const char *device, bool threeWire, const char *gpioChip, uint32_t csLine, const Backend_t &backend=defaultBackend);
+					~SPICLinux();
+		Error_t     init();
+		Error_t     deinit();
+		Error_t     triggerUpdate();
+		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     setClock(uint32_t speed);
+		uint32_t    getClock();
+
+	private:
+
+		const char      *device;      //<! \brief spidev device node
+		const char      *gpioChip;    //<! \brief GPIO character device of the chipselect line, NULL uses the controller chipselect
+		uint32_t        csLine;       //<! \brief chipselect line offset on gpioChip
+		bool            threeWire;    //<! \brief SPI_3WIRE mode of the controller
+		uint32_t        speed;        //<! \brief SPI clock frequency in Hz
+		int             spiFd;        //<! \brief spidev file descriptor
+		int             csFd;         //<! \brief GPIO line handle file descriptor
+		Backend_t       backend;      //<! \brief system call backend
+
+		Error_t     setCS(uint8_t level);
+};
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** SPIC_LINUX_HPP_ **/
@@ -0,0 +1,41 @@
+/**
+ * @file        TLE5012-platf-linux.hpp
+ * @brief       TLE5012 Linux Hardware Platforms
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef TLE5012_PLATF_LINUX_HPP_
+#define TLE5012_PLATF_LINUX_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_LINUX)
+#include <stdio.h>
+
+/**
+ * @class Tle5012Linux
+ *
+ * @brief represents the TLE5012 base class
+ *
+ * This class provides a simple API for connecting the TLE5012 via SSC interface
+ * to the spidev user space interface of an embedded Linux.
+ *
+ * @addtogroup platfLinux
+ * @{
+ */
+
+#include "../pal/TLE5012-pal-linux.hpp"
+
+// Support macros
+//!< \brief Prints a binary number with leading zeros (Automatic Handling)
+#define PRINTBIN(Num) for (uint32_t t = (1UL << ((sizeof(Num)*8)-1)); t; t >>= 1) printf("%u", (Num  & t ? 1 : 0));
+//!< \brief Prints a binary number with leading zeros (Automatic Handling) with space
+#define PRINTBINS(Num) for (uint32_t t = (1UL << ((sizeof(Num)*8)-1)); t; t >>= 1) printf(" %u ", (Num  & t ? 1 : 0));
+
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** TLE5012_PLATF_LINUX_HPP_ **/
@@ -13,6 +13,7 @@
 #include "mtb_rtos.h"
 #include <mtb.h>
 #include <platform.h>
+#include <string.h>
 
 /**
  * @brief Constructor of the MTB SPIC class
@@ -25,9 +26,9 @@ SPICMtb::SPICMtb() : csPin(MTB_GPIO_NONE), port(MTB_SPI_0)
 {
 	this->spi.port = port;
 	this->spi.chip_select = csPin;
-	this->spi.speed = 1000000;
-	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPI_NO_DMA | SPI_LSB_FIRST | SPI_CS_ACTIVE_LOW);
-	this->spi.bits = 8;
+	this->spi.speed = SPI_SPEED_DEFAULT;
+	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPIC_MTB_DMA | SPI_MSB_FIRST | SPI_CS_ACTIVE_LOW);
+	this->spi.bits = 16;
 }
 
 /**
@@ -38,16 +39,18 @@ SPICMtb::SPICMtb() : csPin(MTB_GPIO_NONE), port(MTB_SPI_0)
  *
  * @param port     SPI channel to be used
  * @param csPin    Number of the desired ChipSelect pin
- * 
- * @attention Yet not implemented
+ * @param misoPin  miso pin number, MTB_GPIO_NONE if handled by the SPI block
+ * @param mosiPin  mosi pin number, MTB_GPIO_NONE if handled by the SPI block
+ * @param sckPin   systemclock pin number, MTB_GPIO_NONE if handled by the SPI block
  */
-SPICMtb::SPICMtb(mtb_spi_t port, mtb_gpio_t csPin)
+SPICMtb::SPICMtb(mtb_spi_t port, mtb_gpio_t csPin, mtb_gpio_t misoPin, mtb_gpio_t mosiPin, mtb_gpio_t sckPin)
+	: csPin(csPin), misoPin(misoPin), mosiPin(mosiPin), sckPin(sckPin), port(port)
 {
 	this->spi.port = port;
 	this->spi.chip_select = csPin;
-	this->spi.speed = 1000000;
-	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPI_NO_DMA | SPI_LSB_FIRST | SPI_CS_ACTIVE_LOW);
-	this->spi.bits = 8;
+	this->spi.speed = SPI_SPEED_DEFAULT;
+	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPIC_MTB_DMA | SPI_MSB_FIRST | SPI_CS_ACTIVE_LOW);
+	this->spi.bits = 16;
 }
 
 /**
@@ -63,7 +66,7 @@ SPICMtb::SPICMtb(mtb_spi_t port, mtb_gpio_t csPin)
  * 
  * @attention This does not set the platform_spi_peripherals structure yet
  */
-SPICMtb::SPICMtb(mtb_spi_t port, mtb_gpio_t csPin, uint8_t speed, uint8_t mode, uint8_t bits)
+SPICMtb::SPICMtb(mtb_spi_t port, mtb_gpio_t csPin, uint32_t speed, uint8_t mode, uint8_t bits)
 {
 	this->spi.port = port;
 	this->spi.chip_select = csPin;
@@ -90,11 +93,17 @@ SPICMtb::~SPICMtb()
  */
 SPICMtb::Error_t SPICMtb::init()
 {
-	this->segment.tx_buffer = sendBuffer;
-	this->segment.rx_buffer = receiveBuffer;
-	this->segment.length = 1;
-
+	memset(receiveBuffer, 0, sizeof(receiveBuffer));
 	mtb_spi_init( &this->spi );
+	if (this->csPin != MTB_GPIO_NONE)
+	{
+		mtb_gpio_init(this->csPin, OUTPUT_PUSH_PULL);
+	}
+	// miso stays high impedance, only mosi is turned around per frame
+	if (this->misoPin != MTB_GPIO_NONE)
+	{
+		mtb_gpio_init(this->misoPin, INPUT_HIGH_IMPEDANCE);
+	}
 	return OK;
 }
 
@@ -114,34 +123,150 @@ SPICMtb::Error_t SPICMtb::deinit()
 /**
  * @brief transfers a data package via the spi bus
  *
- * @param send         address and/or command to send
- * @param received     received data from spi bus
+ * @param send         address and/or command to send as 16bit
+ * @param received     received data from spi bus as 16bit
  * @return             SPICMtb::Error_t
  */
-SPICMtb::Error_t SPICMtb::transfer(uint8_t send, uint8_t &received)
+SPICMtb::Error_t SPICMtb::transfer16(uint16_t send, uint16_t &received)
 {
-	sendBuffer[0] = send;
-	receiveBuffer[0] = received;
-	mtb_spi_transfer( &this->spi, &this->segment, 1);
-	return OK;
+	sendBuffer[0] = (uint8_t)((send >> 8) & 0xFF);
+	sendBuffer[1] = (uint8_t)(send & 0xFF);
+
+	Error_t err = transferFrame(sendBuffer, receiveBuffer, 1);
+	received = (uint16_t)(((uint16_t)receiveBuffer[0] << 8) | (receiveBuffer[1]));
+
+	return err;
 }
 
 /**
- * @brief transfers a data package via the spi bus
+ * @brief transfers a number of 16bit words as one segment with one driver call
  *
- * @param send         address and/or command to send as 16bit
- * @param received     received data from spi bus as 16bit
+ * @param send         big endian send data
+ * @param received     big endian receive buffer
+ * @param words        number of 16bit words
  * @return             SPICMtb::Error_t
  */
-SPICMtb::Error_t SPICMtb::transfer16(uint16_t send, uint16_t &received)
+SPICMtb::Error_t SPICMtb::transferFrame(const uint8_t *send, uint8_t *received, uint16_t words)
 {
-	sendBuffer[0] = (uint8_t)((send >> 8) & 0xFF);
-	sendBuffer[1] = (uint8_t)(send & 0xFF);
+	this->segment.tx_buffer = send;
+	this->segment.rx_buffer = received;
+	this->segment.length = 2 * words;
 
-	mtb_spi_transfer( &this->spi, &this->segment, 2);
-	received = (uint16_t)(((uint16_t)receiveBuffer[0] << 8) | (receiveBuffer[1]));
+	if (MTB_SUCCESS != mtb_spi_transfer( &this->spi, &this->segment, 1))
+	{
+		return INTF_ERROR;
+	}
+	return OK;
+}
+
+/**
+ * @brief
+ * Triggers an update in the register buffer. This function
+ * should be triggered once before UPD registers where read as
+ * it generates a snapshot of the UPD register values at trigger point
+ *
+ * @return SPICMtb::Error_t
+ */
+SPICMtb::Error_t SPICMtb::triggerUpdate()
+{
+	if ((this->csPin == MTB_GPIO_NONE) || (this->sckPin == MTB_GPIO_NONE) || (this->mosiPin == MTB_GPIO_NONE))
+	{
+		return CONF_ERROR;
+	}
+	mtb_gpio_output_low(this->sckPin);
+	mtb_gpio_output_high(this->mosiPin);
+	mtb_gpio_output_low(this->csPin);
+	// grace period for register snapshot, chipselect must stay low, nothing runs in parallel
+	mtb_rtos_delay_microseconds( 5 );
+	mtb_gpio_output_high(this->csPin);
+	return OK;
+}
+
+/*!
+* Main SPI three wire communication functions for sending and receiving data.
+* The command words and the read words are each transferred as one segment,
+* so a frame costs two driver calls and one turnaround of the data line
+* independent of the number of words. One segment per frame is not possible:
+* the sensor shares one data line for command and response, so mosi has to be
+* released to high impedance after the last command word and the sensor needs
+* the turnaround time before it drives the first response word. The driver
+* cannot switch a pin or wait in the middle of a segment.
+* @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
+* @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read
+*/
+SPICMtb::Error_t SPICMtb::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	static const uint8_t idleWords[2 * SPIC_MTB_MAX_WORDS] = {0};
+	uint16_t data_index = 0;
+	Error_t err = OK;
+
+	if ((size_of_sent_data > SPIC_MTB_MAX_WORDS) || (size_of_received_data > SPIC_MTB_MAX_WORDS))
+	{
+		return CONF_ERROR;
+	}
+
+	for(data_index = 0; data_index < size_of_sent_data; data_index++)
+	{
+		sendBuffer[2 * data_index]     = (uint8_t)((sent_data[data_index] >> 8) & 0xFF);
+		sendBuffer[2 * data_index + 1] = (uint8_t)(sent_data[data_index] & 0xFF);
+	}
+
+	//send via TX
+	if (this->mosiPin != MTB_GPIO_NONE)
+	{
+		mtb_gpio_init(this->mosiPin, OUTPUT_PUSH_PULL);
+	}
+	if (this->csPin != MTB_GPIO_NONE)
+	{
+		mtb_gpio_output_low(this->csPin);
+	}
+	err = transferFrame(sendBuffer, receiveBuffer, size_of_sent_data);
+
+	// receive via RX
+	if (this->mosiPin != MTB_GPIO_NONE)
+	{
+		mtb_gpio_init(this->mosiPin, INPUT_HIGH_IMPEDANCE);
+	}
+	// the full turnaround gap, same driver limits as the WICED PAL, see spic-wiced.cpp
+	mtb_rtos_delay_microseconds( 5 );
+	if ((err == OK) && (size_of_received_data > 0))
+	{
+		err = transferFrame(idleWords, receiveBuffer, size_of_received_data);
+	}
+	if (this->csPin != MTB_GPIO_NONE)
+	{
+		mtb_gpio_output_high(this->csPin);
+	}
+
+	for(data_index = 0; data_index < size_of_received_data; data_index++)
+	{
+		received_data[data_index] = (uint16_t)(((uint16_t)receiveBuffer[2 * data_index] << 8) | (receiveBuffer[2 * data_index + 1]));
+	}
+	return err;
+}
 
+/**
+ * @brief Sets the SPI clock frequency, used with the next transfer
+ *
+ * @param speed clock frequency in Hz
+ * @return SPICMtb::Error_t
+ */
+SPICMtb::Error_t SPICMtb::setClock(uint32_t speed)
+{
+	this->spi.speed = speed;
 	return OK;
 }
 
+/**
+ * @brief Returns the SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPICMtb::getClock()
+{
+	return this->spi.speed;
+}
+
 #endif /** TLE5012_FRAMEWORK **/
@@ -24,6 +24,12 @@
  * @{
  */
 
+#define SPIC_MTB_MAX_WORDS    16            //!< max words of one direction, 15 data words and the safety word
+
+#ifndef SPIC_MTB_DMA
+#define SPIC_MTB_DMA          SPI_NO_DMA    //!< set to SPI_USE_DMA for SPI blocks with DMA support
+#endif
+
 
 /**
  * @brief Mtb SPIC class
@@ -32,10 +38,10 @@
 class SPICMtb: virtual public SPIC
 {
 	private:
-		mtb_gpio_t         csPin;
-		mtb_gpio_t         misoPin;
-		mtb_gpio_t         mosiPin;
-		mtb_gpio_t         sckPin;
+		mtb_gpio_t         csPin   = MTB_GPIO_NONE;
+		mtb_gpio_t         misoPin = MTB_GPIO_NONE;
+		mtb_gpio_t         mosiPin = MTB_GPIO_NONE;
+		mtb_gpio_t         sckPin  = MTB_GPIO_NONE;
 
 		mtb_spi_t          port;
 		mtb_spi_device_t   spi;
@@ -43,22 +49,27 @@ class SPICMtb: virtual public SPIC
 		uint8_t     mode;
 		uint8_t     clock;
 
-		uint8_t sendBuffer[2];
-		uint8_t receiveBuffer[2];
+		uint8_t sendBuffer[2 * SPIC_MTB_MAX_WORDS];
+		uint8_t receiveBuffer[2 * SPIC_MTB_MAX_WORDS];
 		bool spiSetting = false;
 
 		//* @brief Definition of the SPI-Segment which contains the data for the communication
 		mtb_spi_message_segment_t segment;
 
+		Error_t     transferFrame(const uint8_t *send, uint8_t *received, uint16_t words);
+
 	public:
 		SPICMtb();
-		SPICMtb(mtb_spi_t port, mtb_gpio_t csPin);
-		SPICMtb(mtb_spi_t port, mtb_gpio_t csPin, uint8_t speed, uint8_t mode, uint8_t bits);
+		SPICMtb(mtb_spi_t port, mtb_gpio_t csPin, mtb_gpio_t misoPin=MTB_GPIO_NONE, mtb_gpio_t mosiPin=MTB_GPIO_NONE, mtb_gpio_t sckPin=MTB_GPIO_NONE);
+		SPICMtb(mtb_spi_t port, mtb_gpio_t csPin, uint32_t speed, uint8_t mode, uint8_t bits);
 		~SPICMtb();
 		Error_t     init();
 		Error_t     deinit();
-		Error_t     transfer(uint8_t send, uint8_t &received);
 		Error_t     transfer16(uint16_t send, uint16_t &received);
+		Error_t     triggerUpdate();
+		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     setClock(uint32_t speed);
+		uint32_t    getClock();
 
 };
 /** @} */
@@ -27,10 +27,22 @@
  * @param sckPin   system clock pin for external sensor clock setting
  * @param slave    optional sensor slave setting
  */
-Tle5012Stm32::Tle5012Stm32(uint32_t csPin, GPIO_TypeDef* csPort, uint32_t misoPin, uint32_t mosiPin, uint32_t sckPin, GPIO_TypeDef* spiPort, SPI_HandleTypeDef* hspi, slaveNum slave):Tle5012b()
+Tle5012Stm32::Tle5012Stm32(uint32_t csPin, GPIO_TypeDef* csPort, uint32_t misoPin, uint32_t mosiPin, uint32_t sckPin, GPIO_TypeDef* spiPort, SPI_HandleTypeDef* hspi, slaveNum slave):Tle5012b(),
+	spic(csPin,csPort,misoPin,mosiPin,sckPin,spiPort,hspi)
 {
 	Tle5012b::mSlave = slave;
-	Tle5012b::sBus = new SPICStm32(csPin,csPort,misoPin,mosiPin,sckPin,spiPort,hspi);
+	Tle5012b::sBus = &spic;
+}
+
+/**
+ * @brief Destroy the Tle5012Stm32::Tle5012Stm32 object
+ * The SPI cover is a member and is gone before the base destructor runs,
+ * so the bus is released here.
+ */
+Tle5012Stm32::~Tle5012Stm32()
+{
+	end();
+	Tle5012b::sBus = NULL;
 }
 
 /**
@@ -41,6 +53,22 @@ Tle5012Stm32::Tle5012Stm32(uint32_t csPin, GPIO_TypeDef* csPort, uint32_t misoPi
  * @return errorTypes 
  */
 errorTypes Tle5012Stm32::begin(void)
+{
+	return (begin(NULL));
+}
+
+/**
+ * @brief begin method with a fast boot check of the configuration.
+ * The CRC block 08 - 0F is read once and compared with the image, only
+ * differing registers are written and the CRC of 0F is calculated from
+ * the image, so there is no CRC update cycle. The slave number is
+ * only written if STAT holds another one, so a warm boot with an
+ * unchanged configuration needs no write at all.
+ *
+ * @param configImage  expected values of the registers 08 - 0F, NULL only checks the CRC
+ * @return errorTypes
+ */
+errorTypes Tle5012Stm32::begin(const uint16_t configImage[])
 {
 	#define PIN_SPI_EN    UNUSED_PIN           /*!< TLE5012 Sensor2Go Kit has a switch on/off pin */
 
@@ -49,7 +77,12 @@ errorTypes Tle5012Stm32::begin(void)
 	Tle5012b::en = NULL;
 	// start sensor
 	enableSensor();
-	writeSlaveNumber(Tle5012b::mSlave);
+	applySlaveNumber(Tle5012b::mSlave);
+	if (configImage != NULL)
+	{
+		// fast boot, only registers which differ from the image are written
+		return (applyConfigBlock(configImage));
+	}
 	// initial CRC check, should be = 0
 	return (readBlockCRC());
 }
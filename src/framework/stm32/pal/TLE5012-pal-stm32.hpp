@@ -50,7 +50,15 @@ class Tle5012Stm32: virtual public Tle5012b
 					// Tle5012Stm32();
 					// Tle5012Stm32(uint8_t csPin, slaveNum slave=TLE5012B_S0);
 					Tle5012Stm32(uint32_t csPin, GPIO_TypeDef* csPort, uint32_t misoPin, uint32_t mosiPin, uint32_t sckPin, GPIO_TypeDef* spiPort, SPI_HandleTypeDef* hspi, slaveNum slave);
+					~Tle5012Stm32();
+					Tle5012Stm32(const Tle5012Stm32 &) = delete;   //!< sBus points into this object, a copy would share it
+		Tle5012Stm32 &operator=(const Tle5012Stm32 &) = delete;
 		errorTypes  begin();
+		errorTypes  begin(const uint16_t configImage[]);
+
+	private:
+
+		SPICStm32   spic;                 //!< SPI cover of this sensor, no heap allocation
 
 };
 
@@ -35,6 +35,11 @@ SPIClass3W::SPIClass3W()
 	// this->mMOSI = PIN_SPI_MOSI;
 	// this->mSCK = PIN_SPI_SCK;
 	// this->mSpiNum = 0;
+	this->mhspi = NULL;
+	this->mInFlight = false;
+	this->mTurnaround = 0;
+	this->mSpinMax = 0;
+	this->mTimeout = SPI3W_TIMEOUT_MS;
 }
 
 /**
@@ -62,6 +67,8 @@ void SPIClass3W::begin(uint32_t miso, uint32_t mosi, uint32_t sck, GPIO_TypeDef*
 	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
 	DWT->CYCCNT = 0;
 	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	this->mTurnaround = (HAL_RCC_GetHCLKFreq() / 1000000U) * SPI3W_TURNAROUND_US;
+	this->mSpinMax = 0;
 
 	setCSPin(cs, csPort);
 	this->mhspi = hspi;
@@ -76,6 +83,7 @@ void SPIClass3W::begin(uint32_t miso, uint32_t mosi, uint32_t sck, GPIO_TypeDef*
 	SPI_1LINE_TX(this->mhspi);
 	// __HAL_SPI_ENABLE(this->mhspi);
 	HAL_SPI_Init(this->mhspi);
+	updateTimeout();
 }
 
 /*!
@@ -99,38 +107,244 @@ void SPIClass3W::setCSPin(uint32_t cs, GPIO_TypeDef* csPort)
 }
 
 /*!
- * @brief Main SPI three wire communication functions for sending and receiving data
+ * @brief Returns the APB clock of the used SPI instance
+ *
+ * @return peripheral clock in Hz
+ */
+uint32_t SPIClass3W::peripheralClock()
+{
+	if (this->mhspi->Instance == SPI1
+	#if defined(SPI4)
+		|| this->mhspi->Instance == SPI4
+	#endif
+	#if defined(SPI5)
+		|| this->mhspi->Instance == SPI5
+	#endif
+	#if defined(SPI6)
+		|| this->mhspi->Instance == SPI6
+	#endif
+		)
+	{
+		return HAL_RCC_GetPCLK2Freq();
+	}
+	return HAL_RCC_GetPCLK1Freq();
+}
+
+/*!
+ * @brief Set the SPI clock frequency. The smallest baudrate prescaler
+ * which does not exceed the requested frequency is used. As the SPI is
+ * initialized again for each direction change, the prescaler is active
+ * with the next transfer.
+ *
+ * @param speed [in] clock frequency in Hz
+ */
+void SPIClass3W::setSpeed(uint32_t speed)
+{
+	static const uint32_t prescaler[] = {
+		SPI_BAUDRATEPRESCALER_2,  SPI_BAUDRATEPRESCALER_4,  SPI_BAUDRATEPRESCALER_8,   SPI_BAUDRATEPRESCALER_16,
+		SPI_BAUDRATEPRESCALER_32, SPI_BAUDRATEPRESCALER_64, SPI_BAUDRATEPRESCALER_128, SPI_BAUDRATEPRESCALER_256 };
+	if (this->mhspi == NULL)
+	{
+		return;
+	}
+	uint32_t pclk = peripheralClock();
+	uint8_t i = 0;
+	while ((i < 7) && ((pclk >> (i + 1)) > speed))
+	{
+		i++;
+	}
+	this->mhspi->Init.BaudRatePrescaler = prescaler[i];
+	updateTimeout();
+}
+
+/*!
+ * @brief Returns the actual SPI clock frequency set by the baudrate prescaler
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPIClass3W::getSpeed()
+{
+	if (this->mhspi == NULL)
+	{
+		return 0;
+	}
+	// prescaler bits BR[2:0] select a division by 2^(BR+1)
+	uint32_t br = (this->mhspi->Init.BaudRatePrescaler & SPI_CR1_BR_Msk) >> SPI_CR1_BR_Pos;
+	return (peripheralClock() >> (br + 1));
+}
+
+/*!
+ * @brief Derives the bound of a HAL transfer from the actual clock. The
+ * longest frame must fit, e.g. 17 words at 62.5 kHz need 4.4 ms, and one
+ * tick is added as HAL_GetTick may advance right after the start.
+ */
+void SPIClass3W::updateTimeout()
+{
+	uint32_t speed = getSpeed();
+	if (speed == 0)
+	{
+		return;
+	}
+	this->mTimeout = (((SPI3W_FRAME_BITS * 1000U) + speed - 1U) / speed) + SPI3W_TICK_MARGIN_MS;
+}
+
+/*!
+ * @brief Waits until the turnaround gap since start has passed. Only the rest
+ * of the gap is spent here, whatever the caller did since start counts.
+ *
+ * @param start [in] DWT cycle counter at the begin of the gap
+ * @return DWT cycles spun, 0 if the gap had already passed
+ */
+uint32_t SPIClass3W::waitTurnaround(uint32_t start)
+{
+	uint32_t elapsed = DWT->CYCCNT - start;
+	while ((DWT->CYCCNT - start) < this->mTurnaround);
+	return ((elapsed < this->mTurnaround) ? (this->mTurnaround - elapsed) : 0U);
+}
+
+/*!
+ * @brief Turnaround of a frame, records the longest spin for getTurnaroundSpin
+ *
+ * @param start [in] DWT cycle counter at the end of the command words
+ */
+void SPIClass3W::frameTurnaround(uint32_t start)
+{
+	uint32_t spin = waitTurnaround(start);
+	if (spin > this->mSpinMax)
+	{
+		this->mSpinMax = spin;
+	}
+}
+
+/*!
+ * @brief Longest busy wait of a frame turnaround since begin. The SPI direction
+ * switch runs inside the gap, so this is the part of SPI3W_TURNAROUND_US which is
+ * still spun. A one-shot timer would only pay off if this is a large part of the gap.
+ *
+ * @return DWT cycles, divide by the HCLK frequency in MHz for µs
+ */
+uint32_t SPIClass3W::getTurnaroundSpin()
+{
+	return this->mSpinMax;
+}
+
+/*!
+ * @brief Main SPI three wire communication functions for sending and receiving data.
+ * Each HAL transfer is bounded by the timeout of the actual clock, a failing transfer ends the
+ * frame at once and leaves the bus in transmit mode.
  * 
  * @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
  * @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
  * @param received_data pointer to data structure buffer for the read data
  * @param size_of_received_data size of data words to be read
+ * @return true if both transfers finished in time
  */
-void SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+bool SPIClass3W::sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
 {
+	bool ok = false;
 	//send via TX
 	HAL_GPIO_WritePin(this->mCSPort, this->mCS, GPIO_PIN_RESET);
 	// SPI should be in 1LINE_TX by default
-	HAL_SPI_Transmit(this->mhspi, (uint8_t*)sent_data, size_of_sent_data, 100);
-	
-	uint32_t clk_cycle_start = DWT->CYCCNT;
-	const uint32_t FIVE_MICRO = HAL_RCC_GetHCLKFreq() * 5.0e-6f;
-	while ((DWT->CYCCNT - clk_cycle_start) < FIVE_MICRO);
+	if (HAL_SPI_Transmit(this->mhspi, (uint8_t*)sent_data, size_of_sent_data, this->mTimeout) == HAL_OK)
+	{
+		// the SPI is switched to receive during the turnaround, the clock starts with the receive
+		uint32_t turnaround = DWT->CYCCNT;
+		HAL_SPI_DeInit(this->mhspi);
+		// __HAL_SPI_DISABLE(this->mhspi);
+		SPI_1LINE_RX(this->mhspi);
+		// __HAL_SPI_ENABLE(this->mhspi);
+		HAL_SPI_Init(this->mhspi);
+		frameTurnaround(turnaround);
+
+		ok = (HAL_SPI_Receive(this->mhspi, (uint8_t*)received_data, size_of_received_data, this->mTimeout) == HAL_OK);
+	}
 
+	HAL_GPIO_WritePin(this->mCSPort, this->mCS, GPIO_PIN_SET);
 	HAL_SPI_DeInit(this->mhspi);
 	// __HAL_SPI_DISABLE(this->mhspi);
-	SPI_1LINE_RX(this->mhspi);
+	SPI_1LINE_TX(this->mhspi);
 	// __HAL_SPI_ENABLE(this->mhspi);
 	HAL_SPI_Init(this->mhspi);
+	return ok;
+}
+
+/*!
+ * @brief Starts a frame without waiting for the response. The command words are
+ * sent blocking, the response is received by the SPI interrupt, so the CPU is
+ * free while the response words are clocked. The SPI IRQ handler of the
+ * application must call HAL_SPI_IRQHandler with the SPI handle.
+ *
+ * @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
+ * @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
+ * @param received_data pointer to data structure buffer for the read data, valid until finishSpi
+ * @param size_of_received_data size of data words to be read
+ * @return true if the frame was started
+ */
+bool SPIClass3W::startSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	if ((this->mhspi == NULL) || this->mInFlight)
+	{
+		return false;
+	}
+	//send via TX
+	HAL_GPIO_WritePin(this->mCSPort, this->mCS, GPIO_PIN_RESET);
+	if (HAL_SPI_Transmit(this->mhspi, (uint8_t*)sent_data, size_of_sent_data, this->mTimeout) != HAL_OK)
+	{
+		HAL_GPIO_WritePin(this->mCSPort, this->mCS, GPIO_PIN_SET);
+		return false;
+	}
+
+	uint32_t turnaround = DWT->CYCCNT;
+	HAL_SPI_DeInit(this->mhspi);
+	SPI_1LINE_RX(this->mhspi);
+	HAL_SPI_Init(this->mhspi);
+	frameTurnaround(turnaround);
+
+	this->mInFlight = true;
+	if (HAL_SPI_Receive_IT(this->mhspi, (uint8_t*)received_data, size_of_received_data) != HAL_OK)
+	{
+		finishSpi();
+		return false;
+	}
+	return true;
+}
+
+/*!
+ * @brief Returns true while the response of a frame started by startSpi is received
+ */
+bool SPIClass3W::busySpi()
+{
+	return (this->mInFlight && (HAL_SPI_GetState(this->mhspi) == HAL_SPI_STATE_BUSY_RX));
+}
+
+/*!
+ * @brief Waits for the end of a frame started by startSpi, releases the
+ * chipselect and switches the data line back to transmit. The wait is
+ * bounded by the timeout of the actual clock, a frame which is not done by then is aborted.
+ *
+ * @return true if the response was received without error
+ */
+bool SPIClass3W::finishSpi()
+{
+	if (!this->mInFlight)
+	{
+		return true;
+	}
+	uint32_t start = HAL_GetTick();
+	while (busySpi() && ((HAL_GetTick() - start) < this->mTimeout));
+	bool timeout = busySpi();
+	if (timeout)
+	{
+		HAL_SPI_Abort(this->mhspi);
+	}
+	bool ok = !timeout && (this->mhspi->ErrorCode == HAL_SPI_ERROR_NONE);
 
-	HAL_SPI_Receive(this->mhspi, (uint8_t*)received_data, size_of_received_data, 100);
-	
 	HAL_GPIO_WritePin(this->mCSPort, this->mCS, GPIO_PIN_SET);
 	HAL_SPI_DeInit(this->mhspi);
-	// __HAL_SPI_DISABLE(this->mhspi);
 	SPI_1LINE_TX(this->mhspi);
-	// __HAL_SPI_ENABLE(this->mhspi);
 	HAL_SPI_Init(this->mhspi);
+	this->mInFlight = false;
+	return ok;
 }
 
 /** @} */
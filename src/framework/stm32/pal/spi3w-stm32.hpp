@@ -34,6 +34,10 @@
 #define SPI3W_STM32     5
 
 #define MAX_SLAVE_NUM    4              //!< Maximum numbers of slaves on one SPI bus
+#define SPI3W_TURNAROUND_US 5U          //!< Gap between command and response words for the data line turnaround
+#define SPI3W_FRAME_BITS (17U * 16U)    //!< Longest frame, command, 15 register words and safety word
+#define SPI3W_TICK_MARGIN_MS 1U         //!< HAL_GetTick granularity, a bound of n ticks may end after n - 1 ms
+#define SPI3W_TIMEOUT_MS 2U             //!< Bound of a HAL transfer in ms before begin has set the clock
 // #define SPEED            1000000U       //!< default speed of SPI transfer
 
 class SPIClass3W
@@ -51,7 +55,14 @@ class SPIClass3W
 				~SPIClass3W();
 		void    begin(uint32_t miso, uint32_t mosi, uint32_t sck, GPIO_TypeDef* spiPort, SPI_HandleTypeDef* hspi, uint32_t cs, GPIO_TypeDef* csPort);
 		void    setCSPin(uint32_t cs, GPIO_TypeDef* csPort);
-		void    sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		bool    sendReceiveSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		bool    startSpi(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		bool    busySpi();
+		bool    finishSpi();
+		uint32_t waitTurnaround(uint32_t start);
+		void    setSpeed(uint32_t speed);
+		uint32_t getSpeed();
+		uint32_t getTurnaroundSpin();
 
 	private:
 
@@ -60,7 +71,14 @@ class SPIClass3W
 		uint32_t           mMOSI;     //!< Pin for SPI MOSI
 		uint32_t           mMISO;     //!< Pin for SPI MISO
 		uint32_t           mSCK;      //!< Pin for SPI System Clock
-
+		bool               mInFlight; //!< a frame started by startSpi is not finished
+		uint32_t           mTurnaround; //!< turnaround gap in DWT cycles, set by begin
+		uint32_t           mSpinMax;  //!< longest rest of the gap spun after the direction switch of a frame, in DWT cycles
+		uint32_t           mTimeout;  //!< bound of a HAL transfer in ms, set by begin and setSpeed
+
+		uint32_t           peripheralClock();
+		void               updateTimeout();
+		void               frameTurnaround(uint32_t start);
 
 };
 
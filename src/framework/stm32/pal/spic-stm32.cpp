@@ -60,8 +60,7 @@ SPICStm32::SPICStm32(uint32_t csPin, GPIO_TypeDef* csPort, uint32_t misoPin, uin
  */
 SPICStm32::Error_t SPICStm32::init()
 {
-	this->spi = new SPIClass3W();
-	this->spi->begin(this->misoPin, this->mosiPin, this->sckPin, this->spiPort, this->hspi, this->csPin, this->csPort);
+	this->spi.begin(this->misoPin, this->mosiPin, this->sckPin, this->spiPort, this->hspi, this->csPin, this->csPort);
 	return OK;
 }
 
@@ -94,9 +93,7 @@ SPICStm32::Error_t SPICStm32::triggerUpdate()
 	HAL_GPIO_WritePin(this->csPort, this->csPin, GPIO_PIN_RESET);
 	
 	//grace period for register snapshot
-	uint32_t clk_cycle_start = DWT->CYCCNT;
-	const uint32_t FIVE_MICRO = HAL_RCC_GetHCLKFreq() * 5.0e-6f;
-	while ((DWT->CYCCNT - clk_cycle_start) < FIVE_MICRO);
+	this->spi.waitTurnaround(DWT->CYCCNT);
 
 	HAL_GPIO_WritePin(this->csPort, this->csPin, GPIO_PIN_SET);
 	return OK;
@@ -111,9 +108,75 @@ SPICStm32::Error_t SPICStm32::triggerUpdate()
 */
 SPICStm32::Error_t SPICStm32::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
 {
-	this->spi->setCSPin(this->csPin, this->csPort);
-	this->spi->sendReceiveSpi(sent_data,size_of_sent_data,received_data,size_of_received_data);
-	return OK;
+	// a pending frame of startTransfer has to leave the bus first
+	this->spi.finishSpi();
+	this->spi.setCSPin(this->csPin, this->csPort);
+	return this->spi.sendReceiveSpi(sent_data,size_of_sent_data,received_data,size_of_received_data) ? OK : READ_ERROR;
+}
+
+/*!
+* Starts a frame, the response words are received by the SPI interrupt
+* while the caller continues. The buffers must stay valid until waitTransfer.
+* @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
+* @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read
+*/
+SPICStm32::Error_t SPICStm32::startTransfer(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	this->spi.finishSpi();
+	this->spi.setCSPin(this->csPin, this->csPort);
+	return this->spi.startSpi(sent_data,size_of_sent_data,received_data,size_of_received_data) ? OK : INTF_ERROR;
+}
+
+/**
+ * @brief Waits for the end of the frame started by startTransfer
+ *
+ * @return SPICStm32::Error_t
+ */
+SPICStm32::Error_t SPICStm32::waitTransfer()
+{
+	return this->spi.finishSpi() ? OK : READ_ERROR;
+}
+
+/**
+ * @brief Returns true while the response of a started frame is received
+ */
+bool SPICStm32::isTransferBusy()
+{
+	return this->spi.busySpi();
+}
+
+/**
+ * @brief Sets the SPI clock frequency, needs an initialized SPIC
+ *
+ * @param speed clock frequency in Hz
+ * @return SPICStm32::Error_t
+ */
+SPICStm32::Error_t SPICStm32::setClock(uint32_t speed)
+{
+	this->spi.setSpeed(speed);
+	return (this->spi.getSpeed() != 0) ? OK : CONF_ERROR;
+}
+
+/**
+ * @brief Returns the SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPICStm32::getClock()
+{
+	return this->spi.getSpeed();
+}
+
+/**
+ * @brief Returns the longest busy wait of a frame turnaround
+ *
+ * @return DWT cycles, see SPIClass3W::getTurnaroundSpin
+ */
+uint32_t SPICStm32::getTurnaroundSpin()
+{
+	return this->spi.getTurnaroundSpin();
 }
 
 /** @} */
@@ -43,7 +43,7 @@ class SPICStm32: virtual public SPIC
 		uint32_t           mosiPin;  //<! \brief SPI mosi pin
 		uint32_t           sckPin;   //<! \brief SPI system clock pin
 		SPI_HandleTypeDef* hspi;     //<! \brief SPI handle
-		SPIClass3W         *spi;     //<! \brief extended SPI class pointer
+		SPIClass3W         spi;      //<! \brief extended SPI class, owned by the SPIC
 
 	public:
 					// SPICStm32(uint32_t csPin, GPIO_TypeDef* csPort);
@@ -53,6 +53,12 @@ class SPICStm32: virtual public SPIC
 		Error_t     deinit();
 		Error_t     triggerUpdate();
 		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     setClock(uint32_t speed);
+		uint32_t    getClock();
+		uint32_t    getTurnaroundSpin();
+		Error_t     startTransfer(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     waitTransfer();
+		bool        isTransferBusy();
 
 };
 
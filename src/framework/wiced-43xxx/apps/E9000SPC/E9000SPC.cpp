@@ -38,7 +38,7 @@ float    t_mlow      = 12;   //!< \brief trigger will last default for 12 * 3.0
 
 
 // Tle5012b Object
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 updTypes upd = UPD_high;
 
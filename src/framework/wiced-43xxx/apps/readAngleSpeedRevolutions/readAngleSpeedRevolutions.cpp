@@ -23,7 +23,7 @@
 #include <readAngleSpeedRevolutions.hpp>
 
 // Tle5012b Object
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
@@ -18,7 +18,7 @@
 
 #include <readAngleTest.hpp>
 
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
@@ -26,7 +26,7 @@
 
 #if (TLE5012_FRAMEWORK == TLE5012_FRMWK_WICED)
 
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
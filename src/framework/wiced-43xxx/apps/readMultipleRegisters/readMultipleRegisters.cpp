@@ -28,7 +28,7 @@
 
 #include <readMultipleRegisters.hpp>
 
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 uint16_t command = 0x0050; //!< read register beginning with REG_FSYNC
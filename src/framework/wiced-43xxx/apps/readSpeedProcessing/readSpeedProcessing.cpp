@@ -21,7 +21,7 @@
 
 #include <readSpeedProcessing.hpp>
 
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 void setup() {
@@ -23,7 +23,7 @@
 
 #include "sensorType.hpp"
 
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 
 
@@ -382,6 +382,15 @@ void setup() {
 	show_bin();
 	show_identity();
 	show_additional();
+
+	/*
+	 * The library identifies the variant also with one burst read
+	 * of MOD_1 to MOD_4, without the full register map.
+	 */
+	Reg::sensorType_t type;
+	Reg::interfaceType_t iface;
+	checkError = Tle5012Sensor.readSensorType(type, iface);
+	WPRINT_APP_INFO(("\n\nreadSensorType: %x\tIdentified Sensor PCB: %u\tIdentified Interface: %u\n", checkError, type, iface));
 }
 
 
@@ -21,7 +21,7 @@
 #include <testSensorMainValues.hpp>
 
 // Tle5012b Object
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 updTypes upd = UPD_high;
 
@@ -19,7 +19,7 @@
 
 #include <writeRegisters.hpp>
 
-Tle5012Wiced Tle5012Sensor = Tle5012Wiced();
+Tle5012Wiced Tle5012Sensor;
 errorTypes checkError = NO_ERROR;
 bool s = true;
 
@@ -22,10 +22,11 @@
  * - attached the breakout board on the default SPI of your MCU
  * - attached a bulk chip with the SSC interface to the default SPI of your MCU
  */
-Tle5012Wiced::Tle5012Wiced():Tle5012b()
+Tle5012Wiced::Tle5012Wiced():Tle5012b(),
+	spic(TLE94112_PIN_CS1)
 {
 	Tle5012b::mSlave = TLE5012B_S0;
-	Tle5012b::sBus = new SPICWiced(TLE94112_PIN_CS1);
+	Tle5012b::sBus = &spic;
 }
 
 /**
@@ -36,10 +37,22 @@ Tle5012Wiced::Tle5012Wiced():Tle5012b()
  * @param csPin    pin number of the CS pin
  * @param slave    optional sensor slave setting
  */
-Tle5012Wiced::Tle5012Wiced(wiced_gpio_t csPin, slaveNum slave):Tle5012b()
+Tle5012Wiced::Tle5012Wiced(wiced_gpio_t csPin, slaveNum slave):Tle5012b(),
+	spic(csPin)
 {
 	Tle5012b::mSlave = slave;
-	Tle5012b::sBus = new SPICWiced(csPin);
+	Tle5012b::sBus = &spic;
+}
+
+/**
+ * @brief Destroy the Tle5012Wiced::Tle5012Wiced object
+ * The SPI cover is a member and is gone before the base destructor runs,
+ * so the bus is released here.
+ */
+Tle5012Wiced::~Tle5012Wiced()
+{
+	end();
+	Tle5012b::sBus = NULL;
 }
 
 /**
@@ -51,13 +64,34 @@ Tle5012Wiced::Tle5012Wiced(wiced_gpio_t csPin, slaveNum slave):Tle5012b()
  * @return errorTypes 
  */
 errorTypes Tle5012Wiced::begin(void)
+{
+	return (begin(NULL));
+}
+
+/**
+ * @brief begin method with a fast boot check of the configuration.
+ * The CRC block 08 - 0F is read once and compared with the image, only
+ * differing registers are written and the CRC of 0F is calculated from
+ * the image, so there is no CRC update cycle. The slave number is
+ * only written if STAT holds another one, so a warm boot with an
+ * unchanged configuration needs no write at all.
+ *
+ * @param configImage  expected values of the registers 08 - 0F, NULL only checks the CRC
+ * @return errorTypes
+ */
+errorTypes Tle5012Wiced::begin(const uint16_t configImage[])
 {
 	// init helper libs
 	sBus->init();
 	Tle5012b::en = NULL;
 	// start sensor
 	enableSensor();
-	writeSlaveNumber(Tle5012b::mSlave);
+	applySlaveNumber(Tle5012b::mSlave);
+	if (configImage != NULL)
+	{
+		// fast boot, only registers which differ from the image are written
+		return (applyConfigBlock(configImage));
+	}
 	// initial CRC check, should be = 0
 	return (readBlockCRC());
 }
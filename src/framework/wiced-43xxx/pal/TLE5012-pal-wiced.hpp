@@ -58,7 +58,15 @@ class Tle5012Wiced: virtual public Tle5012b
 
 					Tle5012Wiced();
 					Tle5012Wiced(wiced_gpio_t csPin, slaveNum slave=TLE5012B_S0);
+					~Tle5012Wiced();
+					Tle5012Wiced(const Tle5012Wiced &) = delete;   //!< sBus points into this object, a copy would share it
+		Tle5012Wiced &operator=(const Tle5012Wiced &) = delete;
 		errorTypes  begin();
+		errorTypes  begin(const uint16_t configImage[]);
+
+	private:
+
+		SPICWiced   spic;                 //!< SPI cover of this sensor, no heap allocation
 
 };
 
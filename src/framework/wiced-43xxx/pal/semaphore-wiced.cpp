@@ -0,0 +1,113 @@
+/**
+ * @file        semaphore-wiced.cpp
+ * @brief       WICED Semaphore Platform Abstraction Layer
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "semaphore-wiced.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_WICED)
+
+/**
+ * @brief Constructor of the WICED Semaphore class
+ *
+ */
+SemaphoreWiced::SemaphoreWiced():
+	initialized(false)
+{
+}
+
+/**
+ * @brief Destructor of the WICED Semaphore class
+ *
+ */
+SemaphoreWiced::~SemaphoreWiced()
+{
+	deinit();
+}
+
+/**
+ * @brief Initialization of the Semaphore
+ *
+ * Creates the RTOS semaphore with a count of zero.
+ *
+ * @return      SemaphoreWiced::Error_t
+ */
+SemaphoreWiced::Error_t SemaphoreWiced::init()
+{
+	if (initialized)
+	{
+		return OK;
+	}
+	if (wiced_rtos_init_semaphore(&semaphore) != WICED_SUCCESS)
+	{
+		return ERROR;
+	}
+	initialized = true;
+	return OK;
+}
+
+/**
+ * @brief Deinitialize the Semaphore
+ *
+ * @return      SemaphoreWiced::Error_t
+ */
+SemaphoreWiced::Error_t SemaphoreWiced::deinit()
+{
+	if (!initialized)
+	{
+		return OK;
+	}
+	initialized = false;
+	if (wiced_rtos_deinit_semaphore(&semaphore) != WICED_SUCCESS)
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+/**
+ * @brief Take the Semaphore
+ *
+ * The calling thread is suspended by the RTOS until
+ * the semaphore is given or the timeout has passed.
+ *
+ * @param[in]   timeout Timeout in milliseconds
+ * @return      SemaphoreWiced::Error_t
+ */
+SemaphoreWiced::Error_t SemaphoreWiced::take(uint32_t timeout)
+{
+	if (!initialized)
+	{
+		return ERROR;
+	}
+	wiced_result_t res = wiced_rtos_get_semaphore(&semaphore, (timeout == SEMAPHORE_WAIT_FOREVER) ? WICED_NEVER_TIMEOUT : timeout);
+	if (res == WICED_TIMEOUT)
+	{
+		return TIMEOUT;
+	}
+	return (res == WICED_SUCCESS) ? OK : ERROR;
+}
+
+/**
+ * @brief Give the Semaphore
+ *
+ * @return      SemaphoreWiced::Error_t
+ */
+SemaphoreWiced::Error_t SemaphoreWiced::give()
+{
+	if (!initialized)
+	{
+		return ERROR;
+	}
+	if (wiced_rtos_set_semaphore(&semaphore) != WICED_SUCCESS)
+	{
+		return ERROR;
+	}
+	return OK;
+}
+
+#endif /** TLE5012_FRAMEWORK **/
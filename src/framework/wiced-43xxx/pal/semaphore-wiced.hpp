@@ -0,0 +1,42 @@
+/**
+ * @file        semaphore-wiced.hpp
+ * @brief       WICED Semaphore PAL
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SEMAPHORE_WICED_HPP_
+#define SEMAPHORE_WICED_HPP_
+
+#include "../../../config/tle5012-conf.hpp"
+
+#if (TLE5012_FRAMEWORK == TLE5012_FRMWK_WICED)
+
+#include "../../../pal/semaphore.hpp"
+#include "wiced_rtos.h"
+
+/**
+ * @addtogroup wicedPal
+ * @{
+ */
+
+class SemaphoreWiced: virtual public Semaphore
+{
+	public:
+		SemaphoreWiced();
+		~SemaphoreWiced();
+		Error_t init();
+		Error_t deinit();
+		Error_t take(uint32_t timeout);
+		Error_t give();
+
+	private:
+		wiced_semaphore_t semaphore;
+		bool              initialized;
+};
+/** @} */
+
+#endif /** TLE5012_FRAMEWORK **/
+#endif /** SEMAPHORE_WICED_HPP_ **/
@@ -13,6 +13,7 @@
 #include "wiced_rtos.h"
 #include <wiced.h>
 #include <platform.h>
+#include <string.h>
 
 /**
  * @brief Constructor of the WICED SPIC class
@@ -43,8 +44,8 @@ SPICWiced::SPICWiced(wiced_gpio_t csPin)
 {
 	this->spi.port = WICED_SPI_0;
 	this->spi.chip_select = csPin;
-	this->spi.speed = 1000000;
-	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPI_NO_DMA | SPI_MSB_FIRST | SPI_CS_ACTIVE_LOW);
+	this->spi.speed = SPI_SPEED_DEFAULT;
+	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPIC_WICED_DMA | SPI_MSB_FIRST | SPI_CS_ACTIVE_LOW);
 	this->spi.bits = 16U;
 	this->csPin = csPin;
 }
@@ -66,8 +67,8 @@ SPICWiced::SPICWiced(wiced_spi_t port, wiced_gpio_t csPin, wiced_gpio_t misoPin
 {
 	this->spi.port = port;
 	this->spi.chip_select = csPin;
-	this->spi.speed = 1000000;
-	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPI_NO_DMA | SPI_MSB_FIRST | SPI_CS_ACTIVE_LOW);
+	this->spi.speed = SPI_SPEED_DEFAULT;
+	this->spi.mode = (SPI_CLOCK_RISING_EDGE | SPI_CLOCK_IDLE_LOW | SPIC_WICED_DMA | SPI_MSB_FIRST | SPI_CS_ACTIVE_LOW);
 	this->spi.bits = 16U;
 	this->csPin   = csPin;
 	this->misoPin = misoPin;
@@ -93,12 +94,11 @@ SPICWiced::~SPICWiced()
  */
 SPICWiced::Error_t SPICWiced::init()
 {
-	this->segment.tx_buffer = sendBuffer;
-	this->segment.rx_buffer = receiveBuffer;
-	this->segment.length = 2;
-
+	memset(receiveBuffer, 0, sizeof(receiveBuffer));
 	wiced_spi_init( &this->spi );
 	wiced_gpio_init(this->csPin, OUTPUT_PUSH_PULL);
+	// miso stays high impedance, only mosi is turned around per frame
+	wiced_gpio_init(this->misoPin, INPUT_HIGH_IMPEDANCE);
 	return OK;
 }
 
@@ -127,9 +127,30 @@ SPICWiced::Error_t SPICWiced::transfer16(uint16_t send, uint16_t &received)
 	sendBuffer[0] = (uint8_t)((send >> 8) & 0xFF);
 	sendBuffer[1] = (uint8_t)(send & 0xFF);
 
-	wiced_spi_transfer( &this->spi, &this->segment, 1);
+	Error_t err = transferFrame(sendBuffer, receiveBuffer, 1);
 	received = (uint16_t)(((uint16_t)receiveBuffer[0] << 8) | (receiveBuffer[1]));
 
+	return err;
+}
+
+/**
+ * @brief transfers a number of 16bit words as one segment with one driver call
+ *
+ * @param send         big endian send data
+ * @param received     big endian receive buffer
+ * @param words        number of 16bit words
+ * @return             SPICWiced::Error_t
+ */
+SPICWiced::Error_t SPICWiced::transferFrame(const uint8_t *send, uint8_t *received, uint16_t words)
+{
+	this->segment.tx_buffer = send;
+	this->segment.rx_buffer = received;
+	this->segment.length = 2 * words;
+
+	if (WICED_SUCCESS != wiced_spi_transfer( &this->spi, &this->segment, 1))
+	{
+		return INTF_ERROR;
+	}
 	return OK;
 }
 
@@ -146,14 +167,21 @@ SPICWiced::Error_t SPICWiced::triggerUpdate()
 	wiced_gpio_output_low(this->sckPin);
 	wiced_gpio_output_high(this->mosiPin);
 	wiced_gpio_output_low(this->csPin);
-	// grace period for register snapshot
+	// grace period for register snapshot, chipselect must stay low, nothing runs in parallel
 	wiced_rtos_delay_microseconds( 5 );
 	wiced_gpio_output_high(this->csPin);
 	return OK;
 }
 
 /*!
-* Main SPI three wire communication functions for sending and receiving data
+* Main SPI three wire communication functions for sending and receiving data.
+* The command words and the read words are each transferred as one segment,
+* so a frame costs two driver calls and one turnaround of the data line
+* independent of the number of words. One segment per frame is not possible:
+* the sensor shares one data line for command and response, so mosi has to be
+* released to high impedance after the last command word and the sensor needs
+* the turnaround time before it drives the first response word. The driver
+* cannot switch a pin or wait in the middle of a segment.
 * @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
 * @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
 * @param received_data pointer to data structure buffer for the read data
@@ -161,29 +189,65 @@ SPICWiced::Error_t SPICWiced::triggerUpdate()
 */
 SPICWiced::Error_t SPICWiced::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
 {
-	uint32_t data_index = 0;
-	//send via TX
+	static const uint8_t idleWords[2 * SPIC_WICED_MAX_WORDS] = {0};
+	uint16_t data_index = 0;
+	Error_t err = OK;
+
+	if ((size_of_sent_data > SPIC_WICED_MAX_WORDS) || (size_of_received_data > SPIC_WICED_MAX_WORDS))
+	{
+		return CONF_ERROR;
+	}
 
-	wiced_gpio_init(this->misoPin, INPUT_HIGH_IMPEDANCE);
-	wiced_gpio_init(this->mosiPin, OUTPUT_PUSH_PULL);
-	wiced_gpio_output_low(this->csPin);
 	for(data_index = 0; data_index < size_of_sent_data; data_index++)
 	{
-		transfer16(sent_data[data_index],received_data[0]);
+		sendBuffer[2 * data_index]     = (uint8_t)((sent_data[data_index] >> 8) & 0xFF);
+		sendBuffer[2 * data_index + 1] = (uint8_t)(sent_data[data_index] & 0xFF);
 	}
 
-	// For timing reasons we use only one gpio change
-	// wiced_gpio_init(this->misoPin, OUTPUT_PUSH_PULL);
+	//send via TX
+	wiced_gpio_init(this->mosiPin, OUTPUT_PUSH_PULL);
+	wiced_gpio_output_low(this->csPin);
+	err = transferFrame(sendBuffer, receiveBuffer, size_of_sent_data);
+
+	// receive via RX
 	wiced_gpio_init(this->mosiPin, INPUT_HIGH_IMPEDANCE);
+	// the full turnaround gap after the pin switch: WICED has no portable cycle counter to
+	// spin only the rest as the STM32 PAL does, and dummy clocks cannot fill the gap, as
+	// the sensor shifts out the response with the first clock after it
 	wiced_rtos_delay_microseconds( 5 );
+	if ((err == OK) && (size_of_received_data > 0))
+	{
+		err = transferFrame(idleWords, receiveBuffer, size_of_received_data);
+	}
+	wiced_gpio_output_high(this->csPin);
 
 	for(data_index = 0; data_index < size_of_received_data; data_index++)
 	{
-		transfer16(0x0000,received_data[data_index]);
+		received_data[data_index] = (uint16_t)(((uint16_t)receiveBuffer[2 * data_index] << 8) | (receiveBuffer[2 * data_index + 1]));
 	}
+	return err;
+}
 
-	wiced_gpio_output_high(this->csPin);
+/**
+ * @brief Sets the SPI clock frequency, used with the next transfer
+ *
+ * @param speed clock frequency in Hz
+ * @return SPICWiced::Error_t
+ */
+SPICWiced::Error_t SPICWiced::setClock(uint32_t speed)
+{
+	this->spi.speed = speed;
 	return OK;
 }
 
+/**
+ * @brief Returns the SPI clock frequency
+ *
+ * @return clock frequency in Hz
+ */
+uint32_t SPICWiced::getClock()
+{
+	return this->spi.speed;
+}
+
 #endif /** TLE5012_FRAMEWORK **/
@@ -26,6 +26,12 @@
  * @{
  */
 
+#define SPIC_WICED_MAX_WORDS    16            //!< max words of one direction, 15 data words and the safety word
+
+#ifndef SPIC_WICED_DMA
+#define SPIC_WICED_DMA          SPI_NO_DMA    //!< set to SPI_USE_DMA for SPI ports with DMA support, the default bit banging driver has none
+#endif
+
 
 /**
  * @brief Wiced SPIC class
@@ -44,13 +50,15 @@ class SPICWiced: virtual public SPIC
 		uint8_t            mode;
 		uint8_t            clock;
 
-		uint8_t           sendBuffer[2];
-		uint8_t           receiveBuffer[2];
+		uint8_t            sendBuffer[2 * SPIC_WICED_MAX_WORDS];
+		uint8_t            receiveBuffer[2 * SPIC_WICED_MAX_WORDS];
 		bool               spiSetting = false;
 
 		//* @brief Definition of the SPI-Segment which contains the data for the communication
 		wiced_spi_message_segment_t segment;
 
+		Error_t     transferFrame(const uint8_t *send, uint8_t *received, uint16_t words);
+
 	public:
 
 		SPICWiced(wiced_gpio_t csPin);
@@ -61,6 +69,8 @@ class SPICWiced: virtual public SPIC
 		Error_t     transfer16(uint16_t send, uint16_t &received);
 		Error_t     triggerUpdate();
 		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     setClock(uint32_t speed);
+		uint32_t    getClock();
 
 };
 /** @} */
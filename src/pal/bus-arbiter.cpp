@@ -0,0 +1,136 @@
+/**
+ * @file        bus-arbiter.cpp
+ * @brief       Priority arbitration of a shared SPI cover
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bus-arbiter.hpp"
+
+/**
+ * @brief Construct a new BusArbiter object
+ *
+ * @param bus   SPI cover shared by the tasks
+ * @param lock  semaphore used as mutex of the arbiter, initialized by init
+ */
+BusArbiter::BusArbiter(SPIC &bus, Semaphore &lock):
+	sharedBus(bus),
+	lock(lock),
+	queue(NULL),
+	busy(false)
+{
+}
+
+BusArbiter::~BusArbiter()
+{
+}
+
+SPIC::Error_t BusArbiter::init()
+{
+	if ((lock.init() != Semaphore::OK) || (lock.give() != Semaphore::OK))
+	{
+		return SPIC::CONF_ERROR;
+	}
+	queue = NULL;
+	busy = false;
+	return sharedBus.init();
+}
+
+SPIC::Error_t BusArbiter::deinit()
+{
+	SPIC::Error_t err = sharedBus.deinit();
+	lock.deinit();
+	return err;
+}
+
+SPIC::Error_t BusArbiter::acquire(uint8_t priority, Semaphore &done, uint32_t timeout)
+{
+	Request_t req = { priority, &done, NULL, false };
+
+	lock.take(SEMAPHORE_WAIT_FOREVER);
+	if (!busy)
+	{
+		busy = true;
+		lock.give();
+		return SPIC::OK;
+	}
+	enqueue(&req);
+	lock.give();
+
+	if (done.take(timeout) == Semaphore::OK)
+	{
+		return SPIC::OK;
+	}
+
+	// timed out, but release may have handed over the bus meanwhile
+	lock.take(SEMAPHORE_WAIT_FOREVER);
+	if (req.granted)
+	{
+		lock.give();
+		done.take(SEMAPHORE_WAIT_FOREVER);
+		return SPIC::OK;
+	}
+	remove(&req);
+	lock.give();
+	return SPIC::INTF_ERROR;
+}
+
+void BusArbiter::release()
+{
+	lock.take(SEMAPHORE_WAIT_FOREVER);
+	Request_t *next = queue;
+	if (next != NULL)
+	{
+		// hand over, busy stays set
+		queue = next->next;
+		next->granted = true;
+		next->done->give();
+	}else{
+		busy = false;
+	}
+	lock.give();
+}
+
+SPIC &BusArbiter::bus()
+{
+	return sharedBus;
+}
+
+uint8_t BusArbiter::waiting()
+{
+	uint8_t count = 0;
+	lock.take(SEMAPHORE_WAIT_FOREVER);
+	for (Request_t *req = queue; req != NULL; req = req->next)
+	{
+		count++;
+	}
+	lock.give();
+	return count;
+}
+
+void BusArbiter::enqueue(Request_t *req)
+{
+	Request_t **pos = &queue;
+	while ((*pos != NULL) && ((*pos)->priority >= req->priority))
+	{
+		pos = &(*pos)->next;
+	}
+	req->next = *pos;
+	*pos = req;
+}
+
+void BusArbiter::remove(Request_t *req)
+{
+	Request_t **pos = &queue;
+	while (*pos != NULL)
+	{
+		if (*pos == req)
+		{
+			*pos = req->next;
+			return;
+		}
+		pos = &(*pos)->next;
+	}
+}
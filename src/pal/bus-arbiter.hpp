@@ -0,0 +1,100 @@
+/**
+ * @file        bus-arbiter.hpp
+ * @brief       Priority arbitration of a shared SPI cover
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef BUS_ARBITER_HPP_
+#define BUS_ARBITER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "spic.hpp"
+#include "semaphore.hpp"
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+/**
+ * @brief Arbiter of one SPIC shared by several RTOS tasks
+ *
+ * A task owns the bus between acquire and release. Tasks which find the bus
+ * busy are queued by priority, equal priorities in arrival order, and sleep on
+ * their own completion semaphore. release hands the bus directly to the head
+ * of the queue and gives its semaphore, so a waiting task never spins. The
+ * queue entries live on the stack of the waiting task, the arbiter needs no
+ * heap. The internal lock is a semaphore used as mutex, it is held only for
+ * the queue handling and never during a transfer.
+ */
+class BusArbiter
+{
+	public:
+
+		/**
+		 * @brief Queue entry of a waiting task
+		 */
+		struct Request_t
+		{
+			uint8_t     priority;     //!< \brief higher value is served first
+			Semaphore   *done;        //!< \brief given when the bus is handed over
+			Request_t   *next;        //!< \brief next lower priority request
+			bool        granted;      //!< \brief bus was handed over to this request
+		};
+
+					BusArbiter(SPIC &bus, Semaphore &lock);
+					~BusArbiter();
+
+		/**
+		 * @brief       Initializes the lock and the shared SPIC,
+		 *              call it once before the tasks use the bus
+		 * @return      SPIC error code
+		 */
+		SPIC::Error_t   init();
+
+		/**
+		 * @brief       Deinitializes the shared SPIC and the lock
+		 * @return      SPIC error code
+		 */
+		SPIC::Error_t   deinit();
+
+		/**
+		 * @brief       Waits until the bus is owned by the calling task
+		 * @param[in]   priority request priority, higher value is served first
+		 * @param[in]   done     initialized semaphore of the calling task
+		 * @param[in]   timeout  maximum wait in milliseconds, SEMAPHORE_WAIT_FOREVER waits without limit
+		 * @return      SPIC error code
+		 * @retval      OK if the bus is owned
+		 * @retval      INTF_ERROR if the bus was not free in time
+		 */
+		SPIC::Error_t   acquire(uint8_t priority, Semaphore &done, uint32_t timeout);
+
+		/**
+		 * @brief       Releases the bus, the highest priority waiting task gets it next
+		 */
+		void            release();
+
+		//!< \brief shared SPIC, use it only while the bus is owned
+		SPIC            &bus();
+
+		//!< \brief number of tasks waiting for the bus
+		uint8_t         waiting();
+
+	private:
+
+		SPIC            &sharedBus;   //!< \brief arbitrated SPI cover
+		Semaphore       &lock;        //!< \brief protects busy and queue
+		Request_t       *queue;       //!< \brief waiting requests, highest priority first
+		bool            busy;         //!< \brief bus is owned by a task
+
+		void            enqueue(Request_t *req);
+		void            remove(Request_t *req);
+};
+
+/** @} */
+
+#endif /** BUS_ARBITER_HPP_ **/
@@ -0,0 +1,83 @@
+/**
+ * @file        capture.hpp
+ * @brief       Edge capture Platform Abstraction Layer
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CAPTURE_HPP_
+#define CAPTURE_HPP_
+
+#include <stdint.h>
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+/**
+ * @brief Timestamped edge capture of up to three input channels,
+ * e.g. the IFA/IFB outputs of the sensor in IIF mode
+ */
+class Capture
+{
+	public:
+
+		enum Error_t
+		{
+			OK    = 0,  /**< No error */
+			ERROR = 1,  /**< Error */
+		};
+
+		/**
+		 * @brief       Edge callback, called from interrupt context
+		 * @param[in]   channel   input channel, 0 = IFA, 1 = IFB, 2 = IFC
+		 * @param[in]   level     input level after the edge
+		 * @param[in]   timestamp capture time in ticks of tickRate
+		 * @param[in]   arg       user argument set with init
+		 */
+		typedef void (*EdgeCallback_t)(uint8_t channel, bool level, uint32_t timestamp, void *arg);
+
+		/**
+		 * @brief       Initializes the inputs and starts the capture of both edges
+		 * @param[in]   callback  edge callback
+		 * @param[in]   arg       user argument of the callback
+		 * @return      Capture error code
+		 * @retval      OK if success
+		 * @retval      ERROR if hardware interface error
+		 */
+		virtual  Error_t         init     (EdgeCallback_t callback, void *arg) = 0;
+
+		/**
+		 * @brief       Stops the capture
+		 * @return      Capture error code
+		 * @retval      OK if success
+		 * @retval      ERROR if hardware interface error
+		 */
+		virtual  Error_t         deinit   () = 0;
+
+		/**
+		 * @brief       Reads the actual level of an input
+		 * @param[in]   channel   input channel, 0 = IFA, 1 = IFB, 2 = IFC
+		 * @return      input level
+		 */
+		virtual  bool            level    (uint8_t channel) = 0;
+
+		/**
+		 * @brief       Timestamp of the actual time, same time base as the edges
+		 * @return      time in ticks of tickRate
+		 */
+		virtual  uint32_t        now      () = 0;
+
+		/**
+		 * @brief       Timestamp frequency
+		 * @return      ticks per second
+		 */
+		virtual  uint32_t        tickRate () = 0;
+};
+
+/** @} */
+
+#endif /** CAPTURE_HPP_ **/
@@ -0,0 +1,71 @@
+/**
+ * @file        semaphore.hpp
+ * @brief       Semaphore Platform Abstraction Layer
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SEMAPHORE_HPP_
+#define SEMAPHORE_HPP_
+
+#include <stdint.h>
+
+#define SEMAPHORE_WAIT_FOREVER    0xFFFFFFFFU    //!< timeout value of take() which never times out
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+class Semaphore
+{
+	public:
+
+		enum Error_t
+		{
+			OK      = 0,  /**< No error */
+			ERROR   = 1,  /**< Error */
+			TIMEOUT = 2,  /**< Timeout */
+		};
+
+		/**
+		 * @brief       Initializes the semaphore with a count of zero
+		 * @return      Semaphore error code
+		 * @retval      OK if success
+		 * @retval      ERROR if the RTOS object can not be created
+		 */
+		virtual  Error_t         init    () = 0;
+
+		/**
+		 * @brief       Deinitializes the semaphore
+		 * @return      Semaphore error code
+		 * @retval      OK if success
+		 * @retval      ERROR if the RTOS object can not be deleted
+		 */
+		virtual  Error_t         deinit  () = 0;
+
+		/**
+		 * @brief       Waits until the semaphore is given and decrements it.
+		 *              The calling task is blocked while waiting.
+		 * @param[in]   timeout Timeout in milliseconds, SEMAPHORE_WAIT_FOREVER waits without limit
+		 * @return      Semaphore error code
+		 * @retval      OK if the semaphore was taken
+		 * @retval      TIMEOUT if the semaphore was not given in time
+		 * @retval      ERROR if the semaphore is not initialized
+		 */
+		virtual  Error_t         take    (uint32_t timeout) = 0;
+
+		/**
+		 * @brief       Increments the semaphore and wakes up one waiting task
+		 * @return      Semaphore error code
+		 * @retval      OK if success
+		 * @retval      ERROR if the semaphore is not initialized
+		 */
+		virtual  Error_t         give    () = 0;
+};
+
+/** @} */
+
+#endif /** SEMAPHORE_HPP_ **/
@@ -0,0 +1,132 @@
+/**
+ * @file        spic-shared.cpp
+ * @brief       SPI cover port of a task on an arbitrated bus
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "spic-shared.hpp"
+
+/**
+ * @brief Construct a new SPICShared object
+ *
+ * @param arbiter   arbiter of the shared bus
+ * @param done      completion semaphore, owned by this port only
+ * @param priority  bus request priority, higher value is served first
+ * @param timeout   maximum wait for the bus in milliseconds
+ */
+SPICShared::SPICShared(BusArbiter &arbiter, Semaphore &done, uint8_t priority, uint32_t timeout):
+	arbiter(arbiter),
+	done(done),
+	priority(priority),
+	timeout(timeout),
+	holds(0)
+{
+}
+
+SPICShared::~SPICShared()
+{
+}
+
+SPICShared::Error_t SPICShared::init()
+{
+	return (done.init() == Semaphore::OK) ? OK : CONF_ERROR;
+}
+
+SPICShared::Error_t SPICShared::deinit()
+{
+	while (holds > 0)
+	{
+		unlock();
+	}
+	return (done.deinit() == Semaphore::OK) ? OK : CONF_ERROR;
+}
+
+SPICShared::Error_t SPICShared::lock()
+{
+	if (holds == 0)
+	{
+		Error_t err = arbiter.acquire(priority, done, timeout);
+		if (err != OK)
+		{
+			return err;
+		}
+	}
+	holds++;
+	return OK;
+}
+
+void SPICShared::unlock()
+{
+	if (holds == 0)
+	{
+		return;
+	}
+	holds--;
+	if (holds == 0)
+	{
+		arbiter.release();
+	}
+}
+
+void SPICShared::setPriority(uint8_t priority)
+{
+	this->priority = priority;
+}
+
+SPICShared::Error_t SPICShared::triggerUpdate()
+{
+	Error_t err = lock();
+	if (err != OK)
+	{
+		return err;
+	}
+	err = arbiter.bus().triggerUpdate();
+	unlock();
+	return err;
+}
+
+/*!
+* Sends one command/response frame on the shared bus. The bus is owned for the
+* whole frame, the buffers belong to the calling task.
+* @param sent_data pointer two 2*unit16_t value for one command word and one data word if something should be written
+* @param size_of_sent_data the size of the command word default 1 = only command 2 = command and data word
+* @param received_data pointer to data structure buffer for the read data
+* @param size_of_received_data size of data words to be read
+*/
+SPICShared::Error_t SPICShared::sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	Error_t err = lock();
+	if (err != OK)
+	{
+		return err;
+	}
+	err = arbiter.bus().sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data);
+	unlock();
+	return err;
+}
+
+/**
+ * @brief Sets the clock of the shared bus, which applies to all tasks
+ *
+ * @param speed clock frequency in Hz
+ * @return SPICShared::Error_t
+ */
+SPICShared::Error_t SPICShared::setClock(uint32_t speed)
+{
+	Error_t err = lock();
+	if (err != OK)
+	{
+		return err;
+	}
+	err = arbiter.bus().setClock(speed);
+	unlock();
+	return err;
+}
+
+uint32_t SPICShared::getClock()
+{
+	return arbiter.bus().getClock();
+}
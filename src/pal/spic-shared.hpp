@@ -0,0 +1,71 @@
+/**
+ * @file        spic-shared.hpp
+ * @brief       SPI cover port of a task on an arbitrated bus
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SPIC_SHARED_HPP_
+#define SPIC_SHARED_HPP_
+
+#include "spic.hpp"
+#include "semaphore.hpp"
+#include "bus-arbiter.hpp"
+
+/**
+ * @addtogroup pal
+ * @{
+ */
+
+/**
+ * @brief SPIC of one task on a bus shared through a BusArbiter
+ *
+ * Each task uses its own port and its own Tle5012b object with sBus set to
+ * the port, so command, response and safety word buffers are owned by the task.
+ * Every frame acquires the bus with the priority of the port, which makes
+ * command and response of a frame atomic against the other tasks. Sequences of
+ * frames, e.g. a register write with the following CRC update, are kept together
+ * with lock and unlock, which Tle5012b calls for its multi frame functions.
+ * init and deinit only handle the completion semaphore,
+ * the shared SPIC is initialized by the arbiter.
+ */
+class SPICShared: virtual public SPIC
+{
+	public:
+
+					SPICShared(BusArbiter &arbiter, Semaphore &done, uint8_t priority=0, uint32_t timeout=SEMAPHORE_WAIT_FOREVER);
+					~SPICShared();
+		Error_t     init();
+		Error_t     deinit();
+		Error_t     triggerUpdate();
+		Error_t     sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+		Error_t     setClock(uint32_t speed);
+		uint32_t    getClock();
+
+		/**
+		 * @brief       Keeps the bus owned until the matching unlock, may be nested
+		 * @return      SPIC error code
+		 * @retval      INTF_ERROR if the bus was not free within the timeout
+		 */
+		Error_t     lock();
+
+		//!< \brief ends a lock, the bus is released with the outermost unlock
+		void        unlock();
+
+		//!< \brief sets the priority of the next bus requests
+		void        setPriority(uint8_t priority);
+
+	private:
+
+		BusArbiter  &arbiter;     //<! \brief arbiter of the shared bus
+		Semaphore   &done;        //<! \brief completion semaphore of this task
+		uint8_t     priority;     //<! \brief bus request priority
+		uint32_t    timeout;      //<! \brief maximum wait for the bus in milliseconds
+		uint8_t     holds;        //<! \brief nesting depth of lock
+};
+
+/** @} */
+
+#endif /** SPIC_SHARED_HPP_ **/
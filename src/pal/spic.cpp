@@ -13,4 +13,39 @@
 SPIC::Error_t SPIC::checkErrorStatus()
 {
 	return errorStatus;
-}
\ No newline at end of file
+}
+
+SPIC::Error_t SPIC::setClock(uint32_t speed)
+{
+	(void)speed;
+	return CONF_ERROR;
+}
+
+uint32_t SPIC::getClock()
+{
+	return 0;
+}
+
+SPIC::Error_t SPIC::startTransfer(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+{
+	return sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data);
+}
+
+SPIC::Error_t SPIC::waitTransfer()
+{
+	return OK;
+}
+
+bool SPIC::isTransferBusy()
+{
+	return false;
+}
+
+SPIC::Error_t SPIC::lock()
+{
+	return OK;
+}
+
+void SPIC::unlock()
+{
+}
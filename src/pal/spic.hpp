@@ -12,6 +12,9 @@
 #ifndef SPIC_HPP_
 #define SPIC_HPP_
 
+#define SPI_SPEED_DEFAULT    1000000U    //!< default SPI clock frequency in Hz
+#define SPI_SPEED_MAX        8000000U    //!< maximum SSC clock frequency of the sensor in Hz
+
 /**
  * @addtogroup pal
  * @{
@@ -67,6 +70,65 @@ class SPIC
 		 */
 		virtual Error_t       sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data) = 0;
 
+		/**
+		 * @brief       Sets the SPI clock frequency
+		 * @param[in]   speed   desired clock frequency in Hz, the next lower
+		 *                      frequency supported by the platform is used
+		 * @return      SPIC error code
+		 * @retval      OK if success
+		 * @retval      CONF_ERROR if the platform does not support clock changes
+		 */
+		virtual Error_t       setClock(uint32_t speed);
+
+		/**
+		 * @brief       Returns the actual SPI clock frequency
+		 * @return      clock frequency in Hz, 0 if unknown
+		 */
+		virtual uint32_t      getClock();
+
+		/**
+		 * @brief           Starts a command/response frame and returns while the response
+		 *                  may still be on the wire. The buffers must stay valid until
+		 *                  waitTransfer returns. Only one frame can be in flight.
+		 *                  The default implementation is the blocking sendReceive.
+		 *
+		 * @param sent_data              pointer two 2*unit16_t value for one command word and one data word if something should be written
+		 * @param size_of_sent_data      the size of the command word default 1 = only command 2 = command and data word
+		 * @param received_data          pointer to data structure buffer for the read data
+		 * @param size_of_received_data  size of data words to be read
+		 * @return                       SPIC error code
+		 * @retval                       OK if the frame was started
+		 * @retval                       INTF_ERROR if the frame can not be started
+		 */
+		virtual Error_t       startTransfer(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data);
+
+		/**
+		 * @brief       Waits until the frame started by startTransfer is complete
+		 * @return      SPIC error code
+		 * @retval      OK if success
+		 * @retval      READ_ERROR if the response was not received
+		 */
+		virtual Error_t       waitTransfer();
+
+		/**
+		 * @brief       Returns true while a frame started by startTransfer is on the wire
+		 */
+		virtual bool          isTransferBusy();
+
+		/**
+		 * @brief       Keeps the bus owned for a sequence of frames until the matching
+		 *              unlock, e.g. a register write and the following CRC update.
+		 *              Calls may be nested. The default implementation for a bus with
+		 *              only one user does nothing.
+		 * @return      SPIC error code
+		 * @retval      OK if the bus is owned
+		 * @retval      INTF_ERROR if the bus was not free within the timeout
+		 */
+		virtual Error_t       lock();
+
+		//!< \brief ends a lock, the default implementation does nothing
+		virtual void          unlock();
+
 		Error_t checkErrorStatus();
 
 	private:
@@ -0,0 +1,239 @@
+/**
+ * @file        sim-sensor.cpp
+ * @brief       Simulated TLE5012B behind the system call backend of the Linux PAL
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "sim-sensor.hpp"
+#include <string.h>
+#include <unistd.h>
+#include <linux/gpio.h>
+#include <linux/spi/spidev.h>
+
+#define SIM_FD_SPI          3          //!< file descriptor of the spidev node
+#define SIM_FD_CHIP         4          //!< file descriptor of the GPIO chip
+#define SIM_FD_CS           5          //!< file descriptor of the chipselect line handle
+#define SIM_STAT_SNR        0x6000U    //!< slave number bits of STAT, the only writable ones
+#define SIM_ACSTAT_TRIGGER  0x0401U    //!< self clearing bits of ACSTAT
+
+SimSensor sim;
+
+const SPICLinux::Backend_t SimSensor::backend = { SimSensor::sysOpen, SimSensor::sysClose, SimSensor::sysIoctl };
+
+SimSensor::SimSensor()
+{
+	pthread_mutex_init(&mutex, NULL);
+	reset();
+}
+
+SimSensor::~SimSensor()
+{
+	pthread_mutex_destroy(&mutex);
+}
+
+void SimSensor::reset()
+{
+	for (uint16_t i = 0; i < SIM_NUM_REGS; i++)
+	{
+		regs[i] = (uint16_t) (0x1000 + i);
+	}
+	regs[0] = 0x8000;
+	regs[1] = 0x0000;
+	regs[SIM_CRC_LAST] = (uint16_t) ((regs[SIM_CRC_LAST] & 0xFF00) | blockCrc());
+	status = SIM_STATUS_OK;
+	holdUs = 0;
+	corruptNext = 0;
+	failNext = 0;
+	frames = 0;
+	triggers = 0;
+	overlaps = 0;
+	interleaved = 0;
+	crcWrites = 0;
+	crcErrors = 0;
+	sequence = false;
+	onWire = 0;
+	cs = 1;
+}
+
+static uint8_t simCrc(const uint8_t *data, uint16_t length)
+{
+	uint8_t crc = 0xFF;
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crc ^= data[i];
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x1D) : (uint8_t) (crc << 1);
+		}
+	}
+	return ((uint8_t) ~crc);
+}
+
+uint8_t SimSensor::blockCrc()
+{
+	uint8_t bytes[2 * (SIM_CRC_LAST - SIM_CRC_FIRST + 1)];
+	uint16_t n = 0;
+	for (uint16_t addr = SIM_CRC_FIRST; addr <= SIM_CRC_LAST; addr++)
+	{
+		bytes[n++] = (uint8_t) (regs[addr] >> 8);
+		bytes[n++] = (uint8_t) regs[addr];
+	}
+	// the CRC byte itself is not covered
+	return (simCrc(bytes, n - 1));
+}
+
+uint16_t SimSensor::safety(uint16_t command, const uint16_t *data, uint16_t length)
+{
+	uint8_t bytes[2 * (SIM_NUM_REGS + 1)];
+	uint16_t n = 0;
+	bytes[n++] = (uint8_t) (command >> 8);
+	bytes[n++] = (uint8_t) command;
+	for (uint16_t i = 0; i < length; i++)
+	{
+		bytes[n++] = (uint8_t) (data[i] >> 8);
+		bytes[n++] = (uint8_t) data[i];
+	}
+	return ((uint16_t) (status | simCrc(bytes, n)));
+}
+
+void SimSensor::frame(const uint16_t *sent, uint16_t sentLength, uint16_t *received, uint16_t receivedLength)
+{
+	uint16_t command = sent[0];
+	uint16_t addr = (command >> 4) & 0x3F;
+	uint16_t nd = command & 0x0F;
+
+	frames++;
+	if (sequence && !pthread_equal(owner, pthread_self()))
+	{
+		interleaved++;
+	}
+
+	if (command & 0x8000)
+	{
+		uint16_t data[16];
+		for (uint16_t i = 0; i < nd; i++)
+		{
+			data[i] = regs[(addr + i) % SIM_NUM_REGS];
+		}
+		uint16_t word = safety(command, data, nd);
+		if (corruptNext > 0)
+		{
+			corruptNext--;
+			word ^= 0x0001;
+		}
+		for (uint16_t i = 0; i < receivedLength; i++)
+		{
+			received[i] = (i < nd) ? data[i] : ((i == nd) ? word : 0);
+		}
+		return;
+	}
+
+	for (uint16_t i = 1; i < sentLength; i++)
+	{
+		uint16_t target = (addr + i - 1) % SIM_NUM_REGS;
+		if (target == 0)
+		{
+			regs[0] = (uint16_t) ((regs[0] & ~SIM_STAT_SNR) | (sent[i] & SIM_STAT_SNR));
+		}else if (target == 1)
+		{
+			regs[1] = (uint16_t) (sent[i] & ~SIM_ACSTAT_TRIGGER);
+		}else{
+			regs[target] = sent[i];
+		}
+		if ((target >= SIM_CRC_FIRST) && (target < SIM_CRC_LAST) && !sequence)
+		{
+			sequence = true;
+			owner = pthread_self();
+		}
+		if (target == SIM_CRC_LAST)
+		{
+			crcWrites++;
+			if ((regs[SIM_CRC_LAST] & 0xFF) != blockCrc())
+			{
+				crcErrors++;
+			}
+			sequence = false;
+		}
+	}
+	if (receivedLength > 0)
+	{
+		received[0] = safety(command, &sent[1], (uint16_t) (sentLength - 1));
+	}
+}
+
+int SimSensor::ioctl(int fd, unsigned long request, void *arg)
+{
+	if (request == GPIO_GET_LINEHANDLE_IOCTL)
+	{
+		((struct gpiohandle_request *) arg)->fd = SIM_FD_CS;
+		return 0;
+	}
+	if ((fd == SIM_FD_CS) && (request == GPIOHANDLE_SET_LINE_VALUES_IOCTL))
+	{
+		int level = ((struct gpiohandle_data *) arg)->values[0];
+		pthread_mutex_lock(&mutex);
+		// a chipselect pulse without clocks is an update trigger
+		if ((cs == 0) && (level == 1) && (__sync_fetch_and_add(&onWire, 0) == 0))
+		{
+			triggers++;
+		}
+		cs = level;
+		pthread_mutex_unlock(&mutex);
+		return 0;
+	}
+	if ((fd != SIM_FD_SPI) || (_IOC_TYPE(request) != SPI_IOC_MAGIC))
+	{
+		return -1;
+	}
+	if (_IOC_NR(request) != 0)
+	{
+		// mode, word size and clock
+		return 0;
+	}
+
+	struct spi_ioc_transfer *xfer = (struct spi_ioc_transfer *) arg;
+	uint16_t segments = (uint16_t) (_IOC_SIZE(request) / sizeof(struct spi_ioc_transfer));
+	int ret = 0;
+
+	if (__sync_fetch_and_add(&onWire, 1) != 0)
+	{
+		__sync_fetch_and_add(&overlaps, 1);
+	}
+	if (holdUs > 0)
+	{
+		usleep(holdUs);
+	}
+	pthread_mutex_lock(&mutex);
+	if (failNext > 0)
+	{
+		failNext--;
+		frames++;
+		ret = -1;
+	}else{
+		frame((const uint16_t *) (uintptr_t) xfer[0].tx_buf, (uint16_t) (xfer[0].len / 2),
+			(segments > 1) ? (uint16_t *) (uintptr_t) xfer[1].rx_buf : NULL, (segments > 1) ? (uint16_t) (xfer[1].len / 2) : 0);
+	}
+	pthread_mutex_unlock(&mutex);
+	__sync_fetch_and_sub(&onWire, 1);
+	return ret;
+}
+
+int SimSensor::sysOpen(const char *path, int flags)
+{
+	(void) flags;
+	return (strstr(path, "gpiochip") != NULL) ? SIM_FD_CHIP : SIM_FD_SPI;
+}
+
+int SimSensor::sysClose(int fd)
+{
+	(void) fd;
+	return 0;
+}
+
+int SimSensor::sysIoctl(int fd, unsigned long request, void *arg)
+{
+	return sim.ioctl(fd, request, arg);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file        sim-sensor.hpp
+ * @brief       Simulated TLE5012B behind the system call backend of the Linux PAL
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef SIM_SENSOR_HPP_
+#define SIM_SENSOR_HPP_
+
+#include "framework/linux/pal/spic-linux.hpp"
+#include <pthread.h>
+
+#define SIM_NUM_REGS        64U        //!< register address space of the simulation
+#define SIM_STATUS_OK       0x7000U    //!< safety word status bits without an error
+#define SIM_CRC_FIRST       0x08U      //!< address of MOD_2, first register of the CRC block
+#define SIM_CRC_LAST        0x0FU      //!< address of TCO_Y, holds the CRC of the block
+
+/**
+ * @brief Register model of one sensor on a spidev device
+ *
+ * Each SPI_IOC_MESSAGE is one command/response frame. Read frames return ND
+ * registers and the safety word, write frames store the data word. The model
+ * counts frames which overlap on the wire, frames of other threads inside a
+ * register write and its CRC update, and CRC updates which do not match the
+ * registers. backend is passed to SPICLinux in place of open, close and ioctl.
+ */
+class SimSensor
+{
+	public:
+
+		static const SPICLinux::Backend_t backend;
+
+		uint16_t    regs[SIM_NUM_REGS];    //!< \brief register contents
+		uint16_t    status;                //!< \brief status bits of the next safety words
+		uint32_t    holdUs;                //!< \brief time a frame stays on the wire
+		uint32_t    corruptNext;           //!< \brief number of next read frames with a wrong CRC
+		uint32_t    failNext;              //!< \brief number of next frames failing in the driver
+
+		uint32_t    frames;                //!< \brief frames on the wire
+		uint32_t    triggers;              //!< \brief update triggers by the chipselect line
+		uint32_t    overlaps;              //!< \brief frames started while another was on the wire
+		uint32_t    interleaved;           //!< \brief frames of another thread inside a write sequence
+		uint32_t    crcWrites;             //!< \brief TCO_Y writes, each one checks the block CRC
+		uint32_t    crcErrors;             //!< \brief TCO_Y writes with a wrong block CRC
+
+		SimSensor();
+		~SimSensor();
+
+		//!< \brief restores the default registers and clears the counters
+		void        reset();
+
+		//!< \brief CRC of the configuration registers as the sensor checks it
+		uint8_t     blockCrc();
+
+		//!< \brief safety word of a frame
+		uint16_t    safety(uint16_t command, const uint16_t *data, uint16_t length);
+
+	private:
+
+		pthread_mutex_t mutex;            //!< \brief protects the model against the frames of several threads
+		pthread_t   owner;                //!< \brief thread of the open write sequence
+		bool        sequence;             //!< \brief a CRC register was written, TCO_Y is pending
+		int         onWire;               //!< \brief frames in flight
+		int         cs;                   //!< \brief chipselect level
+
+		void        frame(const uint16_t *sent, uint16_t sentLength, uint16_t *received, uint16_t receivedLength);
+		int         ioctl(int fd, unsigned long request, void *arg);
+
+		static int  sysOpen(const char *path, int flags);
+		static int  sysClose(int fd);
+		static int  sysIoctl(int fd, unsigned long request, void *arg);
+};
+
+extern SimSensor sim;
+
+#endif /** SIM_SENSOR_HPP_ **/
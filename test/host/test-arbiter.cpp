@@ -0,0 +1,142 @@
+/**
+ * @file        test-arbiter.cpp
+ * @brief       Stress test of the bus arbiter with concurrent reads and CRC updating writes
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * Four threads share one simulated sensor on the Linux spidev PAL through a
+ * BusArbiter. Three threads write their own configuration register, which
+ * updates the CRC in TCO_Y, and read it back. One thread reads the angle and
+ * the CRC block. No frame may overlap another one, no frame of another
+ * thread may fall between a register write and its CRC update, and every
+ * CRC written to TCO_Y must match the registers.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "sim-sensor.hpp"
+#include "corelib/TLE5012b.hpp"
+#include "pal/bus-arbiter.hpp"
+#include "pal/spic-shared.hpp"
+#include "framework/linux/pal/semaphore-linux.hpp"
+#include <stdio.h>
+
+#define TEST_WRITERS        3U
+#define TEST_TASKS          (TEST_WRITERS + 1U)
+#define TEST_ITERATIONS     200U
+#define TEST_HOLD_US        20U
+
+static SPICLinux        bus("/dev/spidev0.0", true, "/dev/gpiochip0", 5, SimSensor::backend);
+static SemaphoreLinux   arbiterLock;
+static BusArbiter       arbiter(bus, arbiterLock);
+
+struct Task_t
+{
+	uint8_t     id;
+	uint32_t    errors;
+	uint32_t    mismatches;
+};
+
+static void writer(Tle5012b &sensor, Task_t &task)
+{
+	static const uint16_t commands[TEST_WRITERS] = { Reg::REG_OFFX, Reg::REG_OFFY, Reg::REG_SYNCH };
+	uint16_t command = commands[task.id];
+
+	for (uint32_t i = 0; i < TEST_ITERATIONS; i++)
+	{
+		uint16_t value = (uint16_t) ((task.id << 12) | (i & 0x0FFF));
+		uint16_t data = 0;
+		if (sensor.writeToSensor(command, value, true) != NO_ERROR)
+		{
+			task.errors++;
+		}
+		if (sensor.readFromSensor(command, data) != NO_ERROR)
+		{
+			task.errors++;
+		}else if (data != value)
+		{
+			task.mismatches++;
+		}
+	}
+}
+
+static void reader(Tle5012b &sensor, Task_t &task)
+{
+	for (uint32_t i = 0; i < TEST_ITERATIONS; i++)
+	{
+		double angle = 0.0;
+		if (sensor.getAngleValue(angle) != NO_ERROR)
+		{
+			task.errors++;
+		}
+		if (sensor.readBlockCRC() != NO_ERROR)
+		{
+			task.errors++;
+		}
+	}
+}
+
+static void *run(void *arg)
+{
+	Task_t &task = *(Task_t *) arg;
+	SemaphoreLinux done;
+	SPICShared port(arbiter, done, task.id, 1000);
+	Tle5012b sensor;
+
+	sensor.sBus = &port;
+	if (port.init() != SPIC::OK)
+	{
+		task.errors++;
+		return (NULL);
+	}
+	if (task.id < TEST_WRITERS)
+	{
+		writer(sensor, task);
+	}else{
+		reader(sensor, task);
+	}
+	port.deinit();
+	sensor.sBus = NULL;
+	return (NULL);
+}
+
+int main()
+{
+	pthread_t threads[TEST_TASKS];
+	Task_t tasks[TEST_TASKS];
+	uint32_t errors = 0;
+	uint32_t mismatches = 0;
+
+	sim.holdUs = TEST_HOLD_US;
+	if (arbiter.init() != SPIC::OK)
+	{
+		printf("FAIL arbiter init\n");
+		return (1);
+	}
+	for (uint8_t i = 0; i < TEST_TASKS; i++)
+	{
+		tasks[i].id = i;
+		tasks[i].errors = 0;
+		tasks[i].mismatches = 0;
+		pthread_create(&threads[i], NULL, run, &tasks[i]);
+	}
+	for (uint8_t i = 0; i < TEST_TASKS; i++)
+	{
+		pthread_join(threads[i], NULL);
+		errors += tasks[i].errors;
+		mismatches += tasks[i].mismatches;
+	}
+	arbiter.deinit();
+
+	bool crcValid = ((sim.regs[SIM_CRC_LAST] & 0xFF) == sim.blockCrc());
+	printf("frames %u overlaps %u interleaved %u crc errors %u errors %u mismatches %u waiting %u\n",
+		sim.frames, sim.overlaps, sim.interleaved, sim.crcErrors, errors, mismatches, arbiter.waiting());
+	if ((sim.overlaps != 0) || (sim.interleaved != 0) || (sim.crcErrors != 0)
+		|| (errors != 0) || (mismatches != 0) || !crcValid)
+	{
+		printf("FAIL\n");
+		return (1);
+	}
+	printf("PASS\n");
+	return (0);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file        test-boot.cpp
+ * @brief       Fast boot test of the slave number and the configuration block
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * A cold boot finds another slave number and two changed registers in the
+ * simulated sensor, which are written with the CRC in TCO_Y. A warm boot with
+ * the same slave number and image afterwards only reads STAT and the CRC
+ * block and writes nothing.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+
+#define TEST_WARM_FRAMES    2U      //!< STAT read and CRC block read
+
+int main()
+{
+	SimFixture fixture;
+	Tle5012b &sensor = fixture.sensor;
+	uint16_t image[CRC_NUM_REGISTERS];
+	uint8_t writes = 0;
+	bool written = false;
+
+	if (!fixture.ready)
+	{
+		return (result());
+	}
+	for (uint8_t i = 0; i < CRC_NUM_REGISTERS; i++)
+	{
+		image[i] = sim.regs[SIM_CRC_FIRST + i];
+	}
+	image[1] ^= 0x0010;
+	image[4] ^= 0x0100;
+
+	// cold boot
+	sim.regs[0] = (uint16_t) (sim.regs[0] | Tle5012b::TLE5012B_S2);
+	check(sensor.applySlaveNumber(Tle5012b::TLE5012B_S1, &written) == NO_ERROR, "cold slave status", 0);
+	check(written, "cold slave written", 0);
+	check((sim.regs[0] & Reg::REG_STAT_SNR::mask) == Tle5012b::TLE5012B_S1, "cold slave", sim.regs[0]);
+	check(sensor.applyConfigBlock(image, &writes) == NO_ERROR, "cold block status", 0);
+	check(writes == 3, "cold writes", writes);
+	check((sim.regs[SIM_CRC_LAST] & 0xFF) == sim.blockCrc(), "cold crc", sim.regs[SIM_CRC_LAST]);
+	check(sim.crcErrors == 0, "cold crc errors", sim.crcErrors);
+	check(sensor.readBlockCRC() == NO_ERROR, "cold block crc", 0);
+
+	// warm boot
+	uint32_t frames = sim.frames;
+	check(sensor.applySlaveNumber(Tle5012b::TLE5012B_S1, &written) == NO_ERROR, "warm slave status", 0);
+	check(!written, "warm slave written", 0);
+	check(sensor.applyConfigBlock(image, &writes) == NO_ERROR, "warm block status", 0);
+	check(writes == 0, "warm writes", writes);
+	check(sim.frames - frames == TEST_WARM_FRAMES, "warm frames", sim.frames - frames);
+
+	return (result());
+}
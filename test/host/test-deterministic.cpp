@@ -0,0 +1,111 @@
+/**
+ * @file        test-deterministic.cpp
+ * @brief       Maximum path length of a read in the default and the deterministic mode
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * Angle reads and register bursts run against the simulated sensor while CRC
+ * errors, system errors in the safety word and failing driver transfers are
+ * injected. The frames on the wire are counted for each read. The default
+ * mode resets the safety status inside the read and needs up to two frames,
+ * the deterministic mode needs exactly one and leaves the reset to the caller.
+ * The same holds for the CRC block read.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+
+#define TEST_READS          300U
+#define TEST_FAULTS         6U          //!< fault pattern length, a clean read, CRC, system and bus error, two clean reads
+#define TEST_STATUS_SYSTEM  0x4000U     //!< safety word status bit which reports a system error when cleared
+
+//!< runs the reads with injected faults and returns the maximum number of frames of one read
+static uint32_t run(Tle5012b &sensor, bool deterministic)
+{
+	uint32_t maxFrames = 0;
+	sensor.mDeterministic = deterministic;
+	for (uint32_t i = 0; i < TEST_READS; i++)
+	{
+		uint32_t fault = i % TEST_FAULTS;
+		bool faulty = (fault >= 1) && (fault <= 3);
+		uint16_t data[4];
+		double angle = 0.0;
+		int16_t raw = 0;
+		errorTypes status;
+
+		if (fault == 1)
+		{
+			sim.corruptNext = 1;
+		}else if (fault == 2)
+		{
+			sim.status = SIM_STATUS_OK & ~TEST_STATUS_SYSTEM;
+		}else if (fault == 3)
+		{
+			sim.failNext = 1;
+		}
+		uint32_t frames = sim.frames;
+		if (i % 2)
+		{
+			status = sensor.readMoreRegisters(Reg::REG_AVAL | 4, data);
+		}else{
+			status = sensor.getAngleValue(angle, raw, UPD_low, SAFE_high);
+		}
+		frames = sim.frames - frames;
+		sim.status = SIM_STATUS_OK;
+		if (frames > maxFrames)
+		{
+			maxFrames = frames;
+		}
+
+		check(faulty == (status != NO_ERROR), deterministic ? "deterministic status" : "default status", i);
+		if (deterministic)
+		{
+			check(frames == 1, "deterministic frames", frames);
+			if (fault == 3)
+			{
+				check(status == INTERFACE_ACCESS_ERROR, "deterministic bus error", status);
+			}
+			// the caller resets the safety status when its schedule allows
+			if (sensor.mSafetyPending)
+			{
+				sensor.resetSafety();
+			}
+		}
+	}
+	return (maxFrames);
+}
+
+//!< frames of the CRC block read, the default mode resets the safety status inside
+static uint32_t blockFrames(Tle5012b &sensor, bool deterministic)
+{
+	sensor.mDeterministic = deterministic;
+	sensor.mSafetyPending = false;
+	uint32_t frames = sim.frames;
+	check(sensor.readBlockCRC() == NO_ERROR, "block crc status", deterministic);
+	frames = sim.frames - frames;
+	check(sensor.mSafetyPending == deterministic, "block crc pending", deterministic);
+	if (sensor.mSafetyPending)
+	{
+		sensor.resetSafety();
+	}
+	return (frames);
+}
+
+int main()
+{
+	SimFixture fixture;
+	if (!fixture.ready)
+	{
+		return (result());
+	}
+	uint32_t defaultFrames = run(fixture.sensor, false);
+	uint32_t deterministicFrames = run(fixture.sensor, true);
+	printf("max frames per read default %u deterministic %u\n", defaultFrames, deterministicFrames);
+	check(defaultFrames == 2, "default max frames", defaultFrames);
+	check(deterministicFrames == 1, "deterministic max frames", deterministicFrames);
+	check(blockFrames(fixture.sensor, false) == 2, "default block crc frames", 0);
+	check(blockFrames(fixture.sensor, true) == 1, "deterministic block crc frames", 0);
+
+	return (result());
+}
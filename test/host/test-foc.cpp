@@ -0,0 +1,119 @@
+/**
+ * @file        test-foc.cpp
+ * @brief       Accuracy of the Q15 sine table and the electrical angle conversion
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * The table sine and cosine are compared with libm over all 65536 angles,
+ * the maximum error must stay within 3.7 LSB of Q15. The electrical angle
+ * is checked with pole pairs and offsets, and Tle5012bFOC aligns and reads
+ * on the simulated sensor and leaves the output unchanged on a bus error.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_foc.hpp"
+#include <math.h>
+
+#define TEST_MAX_ERROR      3.7         //!< maximum sine and cosine error in LSB of Q15
+#define TEST_SIM_AVAL       0x02U       //!< register address of AVAL in the simulation
+
+static void testTable()
+{
+	double maxError = 0.0;
+	int16_t s = 0;
+	int16_t c = 0;
+
+	for (uint32_t a = 0; a < FOC_ELECTRICAL_FULL; a++)
+	{
+		ElectricalAngle::sinCos((uint16_t) a, s, c);
+		double r = a * (2.0 * M_PI / FOC_ELECTRICAL_FULL);
+		double es = fabs(s - 32767.0 * sin(r));
+		double ec = fabs(c - 32767.0 * cos(r));
+		maxError = (es > maxError) ? es : maxError;
+		maxError = (ec > maxError) ? ec : maxError;
+		if ((s < -32767) || (c < -32767))
+		{
+			check(false, "q15 range", a);
+		}
+	}
+	printf("max sin/cos error %.2f LSB\n", maxError);
+	check(maxError <= TEST_MAX_ERROR, "max error", maxError);
+
+	// exact values at the quadrant borders
+	check(ElectricalAngle::sine(0) == 0, "sin 0", ElectricalAngle::sine(0));
+	check(ElectricalAngle::sine(FOC_QUARTER) == 32767, "sin 90", ElectricalAngle::sine(FOC_QUARTER));
+	check(ElectricalAngle::sine(2 * FOC_QUARTER) == 0, "sin 180", ElectricalAngle::sine(2 * FOC_QUARTER));
+	check(ElectricalAngle::sine(3 * FOC_QUARTER) == -32767, "sin 270", ElectricalAngle::sine(3 * FOC_QUARTER));
+}
+
+static void testElectrical()
+{
+	ElectricalAngle angle;
+
+	// one pole pair, the raw angle scaled to 16 bit
+	check(angle.electrical(0x1000) == 0x2000, "one pole pair", angle.electrical(0x1000));
+	check(angle.electrical(-0x4000) == 0x8000, "negative raw angle", angle.electrical(-0x4000));
+
+	// seven pole pairs wrap around seven times per revolution
+	angle.configure(7);
+	check(angle.getPolePairs() == 7, "pole pairs", angle.getPolePairs());
+	check(angle.electrical(0x0800) == (uint16_t) (0x1000 * 7), "seven pole pairs", angle.electrical(0x0800));
+
+	// the offset position is electrical 0°
+	angle.configure(4, -1234);
+	check(angle.getOffset() == -1234, "offset", angle.getOffset());
+	check(angle.electrical(-1234) == 0, "offset zero", angle.electrical(-1234));
+	check(angle.electrical(-1234 + 0x2000) == 0, "offset quarter revolution", angle.electrical(-1234 + 0x2000));
+
+	// 12 bit angle base of MOD_3 as offset, 0x800 is 180°
+	angle.configure(1);
+	angle.setAngleBase(0x800);
+	check(angle.electrical(-0x4000) == 0, "angle base", angle.electrical(-0x4000));
+
+	// zero pole pairs are one
+	angle.configure(0);
+	check(angle.getPolePairs() == 1, "zero pole pairs", angle.getPolePairs());
+}
+
+static void testRead()
+{
+	SimFixture fixture;
+	if (!fixture.ready)
+	{
+		return;
+	}
+	Tle5012bFOC foc(fixture.sensor);
+	Tle5012bFOC::Output_t out = {};
+
+	foc.configure(5);
+	sim.regs[TEST_SIM_AVAL] = 0x8000 | 0x1234;
+	check(foc.align() == NO_ERROR, "align", 0);
+	check(foc.angle().getOffset() == 0x1234, "align offset", foc.angle().getOffset());
+
+	sim.regs[TEST_SIM_AVAL] = 0x8000 | (0x1234 + 0x0100);
+	check(foc.read(out) == NO_ERROR, "read", 0);
+	check(out.rawAngle == 0x1334, "read raw angle", out.rawAngle);
+	check(out.electrical == 0x0A00, "read electrical", out.electrical);
+	int16_t s = 0;
+	int16_t c = 0;
+	ElectricalAngle::sinCos(out.electrical, s, c);
+	check((out.sinValue == s) && (out.cosValue == c), "read sin cos", out.sinValue);
+
+	// a failed read leaves the output as it is
+	Tle5012bFOC::Output_t last = out;
+	sim.regs[TEST_SIM_AVAL] = 0x8000;
+	sim.failNext = 1;
+	check(foc.read(out) != NO_ERROR, "failed read", 0);
+	check((out.rawAngle == last.rawAngle) && (out.electrical == last.electrical), "failed read output", out.rawAngle);
+	sim.failNext = 0;
+}
+
+int main()
+{
+	testTable();
+	testElectrical();
+	testRead();
+	return (result());
+}
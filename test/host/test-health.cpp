@@ -0,0 +1,203 @@
+/**
+ * @file        test-health.cpp
+ * @brief       EWMA, Welford statistics and health flags of the magnet and sensor monitor
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * D_MAG and T_RAW values are added directly: the EWMA step response, the
+ * Welford mean and deviation, the learning phase also after more than 65535
+ * values, and each health flag against its limit. record polls D_MAG and
+ * T_RAW of the simulated sensor every interval and follows the error rate.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_health.hpp"
+
+#define TEST_SIM_D_MAG      0x14U       //!< register address of D_MAG in the simulation
+#define TEST_SIM_T_RAW      0x15U       //!< register address of T_RAW in the simulation
+
+static void testEwma()
+{
+	SimFixture fixture;
+	Tle5012bHealth health(fixture.sensor);
+
+	// the first value starts the EWMA, each next one moves it by 1/16 of the difference
+	health.add(100, 300);
+	check(health.magnitude().ewma == 100 << HEALTH_EWMA_FRACTION, "ewma start", health.magnitude().ewma);
+	health.add(200, 300);
+	check(health.magnitude().ewma == (100 << HEALTH_EWMA_FRACTION) + (100 << HEALTH_EWMA_FRACTION) / 16, "ewma step", health.magnitude().ewma);
+	check(health.temperature().ewma == 300 << HEALTH_EWMA_FRACTION, "ewma constant", health.temperature().ewma);
+
+	// the register fields are extracted, D_MAG and T_RAW have 10 bits
+	health.add(0xFC00 | 200, 0xFC00 | 300);
+	check(health.magnitude().last == 200, "mag field", health.magnitude().last);
+	check(health.temperature().last == 300, "temp field", health.temperature().last);
+
+	// the step response reaches the new value within one LSB
+	for (uint16_t i = 0; i < 200; i++)
+	{
+		health.add(200, 300);
+	}
+	Tle5012bHealth::Record_t record;
+	health.health(record);
+	check((record.magnitude >= 199) && (record.magnitude <= 200), "ewma settled", record.magnitude);
+	check(health.magnitude().min == 100, "min", health.magnitude().min);
+	check(health.magnitude().max == 200, "max", health.magnitude().max);
+	check(health.magnitude().count == 203, "count", health.magnitude().count);
+}
+
+static void testWelford()
+{
+	SimFixture fixture;
+	Tle5012bHealth health(fixture.sensor);
+	Tle5012bHealth::Record_t record;
+
+	// 400 and 600 alternating, mean 500 and sample deviation 100 * sqrt(100 / 99)
+	for (uint16_t i = 0; i < 100; i++)
+	{
+		health.add((i % 2) ? 600 : 400, 300);
+	}
+	health.health(record);
+	check(health.magnitude().mean > 499.99 && health.magnitude().mean < 500.01, "welford mean", health.magnitude().mean);
+	check(health.magnitude().m2 > 999999.0 && health.magnitude().m2 < 1000001.0, "welford m2", health.magnitude().m2);
+	check(record.magDeviation == 100, "welford deviation", record.magDeviation);
+	check(health.temperature().m2 == 0.0, "constant m2", health.temperature().m2);
+}
+
+static void testLearning()
+{
+	SimFixture fixture;
+	Tle5012bHealth health(fixture.sensor);
+	Tle5012bHealth::Record_t record;
+
+	// the baseline is the mean of the first HEALTH_LEARN_SAMPLES values
+	for (uint16_t i = 0; i < HEALTH_LEARN_SAMPLES - 1; i++)
+	{
+		health.add(500, 300);
+	}
+	health.health(record);
+	check(record.flags & HEALTH_LEARNING, "learning", record.flags);
+	health.add(500, 300);
+	health.health(record);
+	check(!(record.flags & HEALTH_LEARNING), "learned", record.flags);
+	check(health.magnitude().baseline == 500 << HEALTH_EWMA_FRACTION, "baseline", health.magnitude().baseline);
+
+	// a new learning phase after more than 65535 values still takes its samples
+	for (uint32_t i = 0; i < 70000; i++)
+	{
+		health.add(500, 300);
+	}
+	health.learn(HEALTH_LEARN_SAMPLES);
+	for (uint16_t i = 0; i < HEALTH_LEARN_SAMPLES - 1; i++)
+	{
+		health.add(520, 300);
+	}
+	health.health(record);
+	check(record.flags & HEALTH_LEARNING, "relearning after 65535 values", health.magnitude().count);
+	health.add(520, 300);
+	health.health(record);
+	check(!(record.flags & HEALTH_LEARNING), "relearned", record.flags);
+
+	// learn(0) freezes the actual mean at once
+	health.learn(0);
+	health.health(record);
+	check(!(record.flags & HEALTH_LEARNING), "learn now", record.flags);
+	check(health.magnitude().baseline == (int32_t) (health.magnitude().mean * (1 << HEALTH_EWMA_FRACTION)), "learn now baseline", health.magnitude().baseline);
+}
+
+static void testFlags()
+{
+	SimFixture fixture;
+	Tle5012bHealth health(fixture.sensor);
+	Tle5012bHealth::Record_t record;
+	Tle5012bHealth::Limits_t limits = { 450, 550, 20, 10, 0 };
+
+	health.setLimits(limits);
+	health.learn(0);
+	health.health(record);
+	check(record.flags == HEALTH_LEARNING, "no values", record.flags);
+
+	for (uint16_t i = 0; i < HEALTH_LEARN_SAMPLES; i++)
+	{
+		health.add(500, 300);
+	}
+	health.health(record);
+	check(record.flags == HEALTH_OK, "healthy", record.flags);
+
+	// the magnet moves away, the magnitude drifts and falls below the minimum
+	for (uint16_t i = 0; i < 200; i++)
+	{
+		health.add(420, 300);
+	}
+	health.health(record);
+	check(record.flags == (HEALTH_MAG_LOW | HEALTH_MAG_DRIFT), "weak magnet", record.flags);
+	check(record.magDrift < -70, "weak magnet drift", record.magDrift);
+
+	// too close and a warmer die
+	for (uint16_t i = 0; i < 200; i++)
+	{
+		health.add(580, 330);
+	}
+	health.health(record);
+	check(record.flags == (HEALTH_MAG_HIGH | HEALTH_MAG_DRIFT | HEALTH_TEMP_DRIFT), "strong magnet", record.flags);
+	check(record.tempDrift > 25, "temperature drift", record.tempDrift);
+}
+
+static void testRecord()
+{
+	SimFixture fixture;
+	if (!fixture.ready)
+	{
+		return;
+	}
+	Tle5012bHealth health(fixture.sensor);
+	Tle5012bHealth::Record_t record;
+	Tle5012bHealth::Limits_t limits = { 0, 0, 0, 0, 200 };
+
+	// D_MAG and T_RAW are polled with one burst every interval
+	sim.regs[TEST_SIM_D_MAG] = 0x8000 | 480;
+	sim.regs[TEST_SIM_T_RAW] = 0x8000 | 290;
+	health.setLimits(limits);
+	health.setInterval(4);
+	uint32_t frames = sim.frames;
+	for (uint16_t i = 0; i < 8; i++)
+	{
+		check(health.record(NO_ERROR) == NO_ERROR, "record", i);
+	}
+	check(sim.frames - frames == 2, "poll frames", sim.frames - frames);
+	check(health.getStats().polls == 2, "polls", health.getStats().polls);
+	check(health.magnitude().last == 480, "polled magnitude", health.magnitude().last);
+	check(health.temperature().last == 290, "polled temperature", health.temperature().last);
+
+	// one error raises the rate by 1/256 of HEALTH_RATE_FULL, good reads let it decay
+	health.record(CRC_ERROR);
+	health.health(record);
+	check(record.errorRate == HEALTH_RATE_FULL >> HEALTH_RATE_SHIFT, "error rate", record.errorRate);
+	check(record.flags & HEALTH_ERROR_RATE, "error rate flag", record.flags);
+	for (uint16_t i = 0; i < 200; i++)
+	{
+		health.record(NO_ERROR);
+	}
+	health.health(record);
+	check(!(record.flags & HEALTH_ERROR_RATE), "error rate decayed", record.errorRate);
+	check(health.getStats().errors == 1, "recorded errors", health.getStats().errors);
+
+	// a failed poll adds no values
+	uint32_t count = health.magnitude().count;
+	sim.failNext = 1;
+	check(health.poll() != NO_ERROR, "failed poll", 0);
+	check(health.magnitude().count == count, "failed poll values", health.magnitude().count);
+	check(health.getStats().pollErrors == 1, "poll errors", health.getStats().pollErrors);
+}
+
+int main()
+{
+	testEwma();
+	testWelford();
+	testLearning();
+	testFlags();
+	testRecord();
+	return (result());
+}
@@ -0,0 +1,180 @@
+/**
+ * @file        test-hsm.cpp
+ * @brief       HSM decoder test with synthetic hall sequences
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * A motor model turns at a given speed and generates the IFA, IFB and IFC
+ * hall edges of the sensor in HSM mode, which are fed into HSMDecoder with
+ * their timestamps. The decoded position, interpolated angle and speed are
+ * compared with the model, then invalid states, missed edges and a stall
+ * are checked.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_hsm.hpp"
+#include <math.h>
+
+#define TEST_TICK_RATE      1000000UL   //!< capture ticks per second
+#define TEST_STEP_TICKS     5U          //!< model time step
+#define TEST_POLE_PAIRS     4U
+#define TEST_ANGLE_ERROR    1.0         //!< allowed interpolation error in electrical degrees
+
+//!< hall levels of IFA, IFB and IFC for an electrical angle in degrees, IFA rises at 0°
+static void halls(double electrical, bool levels[3])
+{
+	double e = fmod(electrical, 360.0);
+	if (e < 0.0)
+	{
+		e += 360.0;
+	}
+	levels[0] = (e < 180.0);
+	levels[1] = (e >= 120.0) && (e < 300.0);
+	levels[2] = (e >= 240.0) || (e < 60.0);
+}
+
+struct Motor_t
+{
+	double      mechanical;     //!< mechanical angle in degrees
+	uint32_t    now;            //!< time in ticks
+	bool        levels[3];      //!< hall levels
+};
+
+//!< turns the motor for a number of steps and feeds the changed levels into the decoder
+static void turn(HSMDecoder &decoder, Motor_t &motor, double speed, uint32_t steps, double *maxError)
+{
+	for (uint32_t i = 0; i < steps; i++)
+	{
+		bool levels[3];
+		motor.now += TEST_STEP_TICKS;
+		motor.mechanical += speed * TEST_STEP_TICKS / TEST_TICK_RATE;
+		halls(motor.mechanical * TEST_POLE_PAIRS, levels);
+		for (uint8_t c = 0; c < 3; c++)
+		{
+			if (levels[c] != motor.levels[c])
+			{
+				decoder.edge(c, levels[c], motor.now);
+				motor.levels[c] = levels[c];
+			}
+		}
+		// the interpolation needs two sectors of the same direction
+		if ((maxError != NULL) && (decoder.sectorPeriod() != 0) && ((i % 100) == 0))
+		{
+			double expected = fmod(motor.mechanical * TEST_POLE_PAIRS, 360.0);
+			double actual = decoder.electricalAngle(motor.now) * 360.0 / HSM_ELECTRICAL_FULL;
+			double error = fabs(actual - (expected < 0.0 ? expected + 360.0 : expected));
+			if (error > 180.0)
+			{
+				error = 360.0 - error;
+			}
+			if (error > *maxError)
+			{
+				*maxError = error;
+			}
+		}
+	}
+}
+
+static void testRotation()
+{
+	HSMDecoder decoder;
+	Motor_t motor = { 10.0, 0, { false, false, false } };
+	double maxError = 0.0;
+
+	decoder.setTickRate(TEST_TICK_RATE);
+	decoder.configure(TEST_POLE_PAIRS);
+	halls(motor.mechanical * TEST_POLE_PAIRS, motor.levels);
+	decoder.setLevels(motor.levels[0], motor.levels[1], motor.levels[2]);
+	check(decoder.sector() == 0, "start sector", decoder.sector());
+
+	// one second forward at 900°/s, 60 sectors per second per pole pair
+	turn(decoder, motor, 900.0, 200000, &maxError);
+	check(maxError < TEST_ANGLE_ERROR, "forward interpolation", maxError);
+	check(decoder.position() == 60, "forward position", decoder.position());
+	check(decoder.sectorRate(motor.now) == 60, "forward rate", decoder.sectorRate(motor.now));
+	check(fabs(decoder.angleSpeed(motor.now) - 900.0) < 1.0, "forward speed", decoder.angleSpeed(motor.now));
+
+	// reverse at 600°/s, the first sectors after the reversal have no period
+	turn(decoder, motor, -600.0, 12000, NULL);
+	maxError = 0.0;
+	turn(decoder, motor, -600.0, 188000, &maxError);
+	check(maxError < TEST_ANGLE_ERROR, "reverse interpolation", maxError);
+	check(decoder.sectorRate(motor.now) == -40, "reverse rate", decoder.sectorRate(motor.now));
+	check(fabs(decoder.angleSpeed(motor.now) + 600.0) < 1.0, "reverse speed", decoder.angleSpeed(motor.now));
+
+	double expected = (motor.mechanical - 10.0) * TEST_POLE_PAIRS * HSM_SECTORS / 360.0;
+	check(fabs(decoder.position() - expected) < 1.0, "position", decoder.position());
+	check(decoder.getStats().invalid == 0, "invalid", decoder.getStats().invalid);
+	check(decoder.getStats().missed == 0, "missed", decoder.getStats().missed);
+	check(decoder.getStats().skipped == 0, "skipped", decoder.getStats().skipped);
+
+	// stall, the angle stops at the sector border and the rate decays to zero
+	uint16_t first = decoder.electricalAngle(motor.now + 100000);
+	uint16_t second = decoder.electricalAngle(motor.now + 200000);
+	check(first == second, "stall angle", second);
+	check(decoder.sectorRate(motor.now + TEST_TICK_RATE) == 0, "stall rate", decoder.sectorRate(motor.now + TEST_TICK_RATE));
+}
+
+static void testSectors()
+{
+	// hall states A B C of the sectors 0 to 5
+	static const bool states[HSM_SECTORS][3] = {
+		{ true, false, true }, { true, false, false }, { true, true, false },
+		{ false, true, false }, { false, true, true }, { false, false, true }
+	};
+	HSMDecoder decoder;
+	decoder.configure(1);
+	decoder.setLevels(states[0][0], states[0][1], states[0][2]);
+
+	uint32_t now = 0;
+	for (uint8_t i = 1; i <= 2 * HSM_SECTORS; i++)
+	{
+		const bool *from = states[(i - 1) % HSM_SECTORS];
+		const bool *to = states[i % HSM_SECTORS];
+		for (uint8_t c = 0; c < 3; c++)
+		{
+			if (from[c] != to[c])
+			{
+				decoder.edge(c, to[c], now += 1000);
+			}
+		}
+		check(decoder.sector() == (i % HSM_SECTORS), "sector", decoder.sector());
+	}
+	check(decoder.position() == 2 * HSM_SECTORS, "sector position", decoder.position());
+	check(decoder.rawAngle() == 0, "two revolutions", decoder.rawAngle());
+
+	// IFB rises in sector 0, the hall state 111 is invalid
+	decoder.edge(1, true, now += 1000);
+	check(decoder.sector() == HSM_INVALID_SECTOR, "invalid sector", decoder.sector());
+	check(decoder.getStats().invalid == 1, "invalid count", decoder.getStats().invalid);
+	decoder.edge(1, false, now += 1000);
+	check(decoder.sector() == 0, "back from invalid", decoder.sector());
+
+	// a second rising edge of IFA without the falling edge
+	decoder.edge(0, true, now += 1000);
+	check(decoder.getStats().missed == 1, "missed edge", decoder.getStats().missed);
+}
+
+static void testInvert()
+{
+	HSMDecoder decoder;
+	Motor_t motor = { 0.5, 0, { false, false, false } };
+
+	decoder.setTickRate(TEST_TICK_RATE);
+	decoder.configure(TEST_POLE_PAIRS, true);
+	halls(motor.mechanical * TEST_POLE_PAIRS, motor.levels);
+	decoder.setLevels(motor.levels[0], motor.levels[1], motor.levels[2]);
+	turn(decoder, motor, 900.0, 20000, NULL);
+	check(decoder.position() == -6, "inverted position", decoder.position());
+	check(decoder.sectorRate(motor.now) < 0, "inverted rate", decoder.sectorRate(motor.now));
+}
+
+int main()
+{
+	testRotation();
+	testSectors();
+	testInvert();
+	return (result());
+}
@@ -0,0 +1,245 @@
+/**
+ * @file        test-iif.cpp
+ * @brief       IIF decoder test with synthetic A/B and step/direction edge streams
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * Timestamped IFA and IFB edges as the sensor emits them in IIF mode are fed
+ * into IIFDecoder: forward and reverse quadrature, step/direction pulses, a
+ * missed edge and the drift correction with AVAL. Tle5012bIIF is started on
+ * the simulated sensor with a capture which fires an edge right after init.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_iif.hpp"
+#include <math.h>
+
+#define TEST_TICK_RATE      1000000UL   //!< capture ticks per second
+#define TEST_PERIOD         100U        //!< ticks between two edges
+#define TEST_SIM_MOD_1      0x06U       //!< register address of MOD_1 in the simulation
+#define TEST_SIM_MOD_4      0x0EU       //!< register address of MOD_4 in the simulation
+#define TEST_SIM_AVAL       0x02U       //!< register address of AVAL in the simulation
+
+//!< IFA and IFB levels of the quadrature signal
+struct Quadrature_t
+{
+	bool        a;
+	bool        b;
+	uint32_t    now;
+};
+
+//!< feeds edges of a quadrature signal, IFA leads IFB for the positive direction
+static void quadrature(IIFDecoder &decoder, Quadrature_t &q, bool forward, uint32_t edges)
+{
+	for (uint32_t i = 0; i < edges; i++)
+	{
+		q.now += TEST_PERIOD;
+		if ((q.a == q.b) == forward)
+		{
+			q.a = !q.a;
+			decoder.edge(0, q.a, q.now);
+		}else{
+			q.b = !q.b;
+			decoder.edge(1, q.b, q.now);
+		}
+	}
+}
+
+static void testQuadrature()
+{
+	IIFDecoder decoder;
+	Quadrature_t q = { false, false, 0 };
+
+	decoder.setTickRate(TEST_TICK_RATE);
+	decoder.configure(IIFDecoder::IIF_AB, 0);
+	decoder.setLevels(q.a, q.b);
+	check(decoder.countsPerRevolution() == 4096, "counts per revolution", decoder.countsPerRevolution());
+
+	// forward, 1000 increments of 0.088°
+	quadrature(decoder, q, true, 1000);
+	check(decoder.count() == 1000, "forward count", decoder.count());
+	check(decoder.rawAngle() == 8000, "forward raw angle", decoder.rawAngle());
+	check(fabs(decoder.angleValue() - 87.890625) < 1e-6, "forward angle", decoder.angleValue());
+	check(decoder.countRate(q.now) == 10000, "forward rate", decoder.countRate(q.now));
+	check(fabs(decoder.angleSpeed(q.now) - 878.90625) < 1e-6, "forward speed", decoder.angleSpeed(q.now));
+
+	// reverse beyond zero, the angle wraps to the negative half
+	quadrature(decoder, q, false, 1500);
+	check(decoder.count() == -500, "reverse count", decoder.count());
+	check(decoder.rawAngle() == -4000, "reverse raw angle", decoder.rawAngle());
+	check(decoder.countRate(q.now) == -10000, "reverse rate", decoder.countRate(q.now));
+
+	// the rate decays without edges and is zero after one second
+	check(decoder.countRate(q.now + 4 * TEST_PERIOD) == -2500, "decaying rate", decoder.countRate(q.now + 4 * TEST_PERIOD));
+	check(decoder.countRate(q.now + TEST_TICK_RATE) == 0, "stopped rate", decoder.countRate(q.now + TEST_TICK_RATE));
+
+	// a second edge with the same IFA level, the opposite edge was missed
+	decoder.edge(0, q.a, q.now + TEST_PERIOD);
+	check(decoder.count() == -500, "missed edge count", decoder.count());
+	check(decoder.getStats().invalid == 1, "missed edge", decoder.getStats().invalid);
+	check(decoder.getStats().edges == 2501, "edges", decoder.getStats().edges);
+
+	// inverted direction and the lowest resolution
+	decoder.configure(IIFDecoder::IIF_AB, 3, true);
+	check(decoder.countsPerRevolution() == 512, "9 bit counts per revolution", decoder.countsPerRevolution());
+	quadrature(decoder, q, true, 10);
+	check(decoder.count() == -10, "inverted count", decoder.count());
+	check(decoder.rawAngle() == -640, "inverted raw angle", decoder.rawAngle());
+}
+
+static void testStepDirection()
+{
+	IIFDecoder decoder;
+	uint32_t now = 0;
+
+	decoder.configure(IIFDecoder::IIF_STEP_DIR, 0);
+	decoder.setLevels(false, false);
+	// IFB low counts up on each rising IFA edge
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		decoder.edge(0, true, now += TEST_PERIOD);
+		decoder.edge(0, false, now += TEST_PERIOD);
+	}
+	check(decoder.count() == 5, "step up", decoder.count());
+
+	// IFB high counts down, the IFB edge itself is no step
+	decoder.edge(1, true, now += TEST_PERIOD);
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		decoder.edge(0, true, now += TEST_PERIOD);
+		decoder.edge(0, false, now += TEST_PERIOD);
+	}
+	check(decoder.count() == 2, "step down", decoder.count());
+
+	// a missed falling edge, the next rising edge is no step
+	decoder.edge(0, true, now += TEST_PERIOD);
+	decoder.edge(0, true, now += TEST_PERIOD);
+	check(decoder.count() == 1, "missed step edge", decoder.count());
+	check(decoder.getStats().invalid == 1, "missed step", decoder.getStats().invalid);
+}
+
+static void testSynchronize()
+{
+	IIFDecoder decoder;
+	Quadrature_t q = { false, false, 0 };
+
+	decoder.configure(IIFDecoder::IIF_AB, 0);
+	decoder.setLevels(q.a, q.b);
+	quadrature(decoder, q, true, 100);
+
+	// three increments were lost, AVAL is ahead
+	check(decoder.synchronize(103 << 3) == 3, "drift", decoder.getStats().lastDrift);
+	check(decoder.count() == 103, "synchronized count", decoder.count());
+	quadrature(decoder, q, true, 10);
+	check(decoder.count() == 113, "count after synchronize", decoder.count());
+
+	// the correction takes the shortest way over the zero position
+	decoder.configure(IIFDecoder::IIF_AB, 0);
+	decoder.setLevels(q.a, q.b);
+	quadrature(decoder, q, false, 2);
+	check(decoder.synchronize(1 << 3) == 3, "drift over zero", decoder.getStats().lastDrift);
+	check(decoder.count() == 1, "count over zero", decoder.count());
+	check(decoder.synchronize(-(8 << 3)) == -9, "negative angle", decoder.getStats().lastDrift);
+	check(decoder.count() == -8, "negative count", decoder.count());
+
+	check(decoder.getStats().resyncs == 3, "resyncs", decoder.getStats().resyncs);
+	check(decoder.getStats().maxDrift == 9, "max drift", decoder.getStats().maxDrift);
+}
+
+/**
+ * @brief Capture which fires one IFA edge right after init, as an edge
+ * arriving between the start of the capture and the first level read
+ */
+class EdgeCapture: public Capture
+{
+	public:
+
+		bool        a;            //!< IFA level
+		bool        b;            //!< IFB level
+		uint32_t    levelsBefore; //!< level reads before init
+
+		EdgeCapture(): a(false), b(false), levelsBefore(0), callback_(NULL), arg_(NULL), running_(false) {}
+
+		Error_t init(EdgeCallback_t callback, void *arg)
+		{
+			callback_ = callback;
+			arg_ = arg;
+			running_ = true;
+			a = true;
+			callback_(0, a, now(), arg_);
+			return OK;
+		}
+
+		Error_t deinit()
+		{
+			running_ = false;
+			return OK;
+		}
+
+		bool level(uint8_t channel)
+		{
+			if (!running_)
+			{
+				levelsBefore++;
+			}
+			return (channel == 0) ? a : b;
+		}
+
+		uint32_t now() { return 0; }
+		uint32_t tickRate() { return TEST_TICK_RATE; }
+
+		//!< next edge of the positive direction
+		void forward()
+		{
+			if (a == b)
+			{
+				a = !a;
+				callback_(0, a, now(), arg_);
+			}else{
+				b = !b;
+				callback_(1, b, now(), arg_);
+			}
+		}
+
+	private:
+
+		EdgeCallback_t  callback_;
+		void            *arg_;
+		bool            running_;
+};
+
+static void testBegin()
+{
+	SimFixture fixture;
+	if (!fixture.ready)
+	{
+		return;
+	}
+	EdgeCapture capture;
+	Tle5012bIIF iif(fixture.sensor, capture);
+
+	sim.regs[TEST_SIM_MOD_1] = IIFDecoder::IIF_AB;
+	sim.regs[TEST_SIM_MOD_4] = 0;
+	sim.regs[TEST_SIM_AVAL] = 0x8000 | (128 << 3);
+	check(iif.begin() == NO_ERROR, "begin", 0);
+	check(capture.levelsBefore == 0, "levels read before the capture started", capture.levelsBefore);
+	check(iif.decoder().count() == 128, "begin count", iif.decoder().count());
+
+	// the decoder follows the levels after the early edge
+	capture.forward();
+	capture.forward();
+	check(iif.decoder().count() == 130, "count after begin", iif.decoder().count());
+	check(iif.decoder().getStats().invalid == 0, "invalid after begin", iif.decoder().getStats().invalid);
+	iif.end();
+}
+
+int main()
+{
+	testQuadrature();
+	testStepDirection();
+	testSynchronize();
+	testBegin();
+	return (result());
+}
@@ -0,0 +1,205 @@
+/**
+ * @file        test-pipeline.cpp
+ * @brief       Pipelined reads on an asynchronous and a blocking SPI cover
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * AsyncBus puts the simulated sensor behind a SPIC whose startTransfer
+ * returns at once. The frame stays on the wire for a number of
+ * isTransferBusy polls and is clocked by waitTransfer. The pipeline must
+ * overlap every decode with the next frame, count wire and CPU bound reads,
+ * and recover from a CRC error with one resetSafety before it restarts. On
+ * the blocking SPIC of the Linux PAL it must show no overlap.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_pipeline.hpp"
+
+#define TEST_READS          100U
+#define TEST_CRC_READ       40U         //!< read which gets a corrupted frame
+#define TEST_COMMAND        (Reg::REG_AVAL | 0x0002)
+
+/**
+ * @brief SPIC with an asynchronous frame on top of the blocking sim bus
+ */
+class AsyncBus: public SPIC
+{
+	public:
+
+		uint16_t    wirePolls;    //!< isTransferBusy polls a frame stays on the wire
+		uint32_t    started;      //!< frames started with startTransfer
+		uint32_t    blocking;     //!< blocking frames with sendReceive, e.g. resetSafety
+
+		AsyncBus(SPIC &bus): wirePolls(0), started(0), blocking(0), bus_(bus), pending_(false), polls_(0),
+			sent_(NULL), sentLength_(0), received_(NULL), receivedLength_(0)
+		{
+		}
+
+		Error_t init() { return bus_.init(); }
+		Error_t deinit() { return bus_.deinit(); }
+		Error_t triggerUpdate() { return bus_.triggerUpdate(); }
+
+		Error_t sendReceive(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+		{
+			blocking++;
+			return bus_.sendReceive(sent_data, size_of_sent_data, received_data, size_of_received_data);
+		}
+
+		Error_t startTransfer(uint16_t* sent_data, uint16_t size_of_sent_data, uint16_t* received_data, uint16_t size_of_received_data)
+		{
+			if (pending_)
+			{
+				return INTF_ERROR;
+			}
+			started++;
+			pending_ = true;
+			polls_ = wirePolls;
+			sent_ = sent_data;
+			sentLength_ = size_of_sent_data;
+			received_ = received_data;
+			receivedLength_ = size_of_received_data;
+			return OK;
+		}
+
+		Error_t waitTransfer()
+		{
+			if (!pending_)
+			{
+				return OK;
+			}
+			pending_ = false;
+			polls_ = 0;
+			return bus_.sendReceive(sent_, sentLength_, received_, receivedLength_);
+		}
+
+		bool isTransferBusy()
+		{
+			if (pending_ && (polls_ > 0))
+			{
+				polls_--;
+				return true;
+			}
+			return false;
+		}
+
+	private:
+
+		SPIC        &bus_;
+		bool        pending_;
+		uint16_t    polls_;
+		uint16_t    *sent_;
+		uint16_t    sentLength_;
+		uint16_t    *received_;
+		uint16_t    receivedLength_;
+};
+
+//!< reads through the pipeline and compares the data with the registers of the simulation
+static uint32_t run(Tle5012bPipeline &pipeline, uint32_t crcRead)
+{
+	uint32_t errors = 0;
+	check(pipeline.start(TEST_COMMAND) == NO_ERROR, "start", 0);
+	pipeline.clearStats();
+	for (uint32_t i = 0; i < TEST_READS; i++)
+	{
+		uint16_t data[2];
+		if (i == crcRead)
+		{
+			sim.corruptNext = 1;
+		}
+		errorTypes status = pipeline.read(data);
+		if (i == crcRead)
+		{
+			check(status == CRC_ERROR, "crc status", status);
+			check((data[0] == 0) && (data[1] == 0), "crc data cleared", i);
+			check(pipeline.isRunning(), "restarted", i);
+			continue;
+		}
+		if ((status != NO_ERROR) || (data[0] != sim.regs[2]) || (data[1] != sim.regs[3]))
+		{
+			errors++;
+		}
+	}
+	check(pipeline.stop() == NO_ERROR, "stop", 0);
+	return (errors);
+}
+
+static void testWireBound(SimFixture &fixture)
+{
+	AsyncBus async(fixture.bus);
+	fixture.sensor.sBus = &async;
+	Tle5012bPipeline pipeline(fixture.sensor);
+
+	// the frame is still busy after the decode of the previous one
+	async.wirePolls = 2;
+	check(run(pipeline, TEST_READS) == 0, "wire bound errors", 0);
+	const Tle5012bPipeline::Stats_t &stats = pipeline.getStats();
+	check(stats.frames == TEST_READS, "wire bound frames", stats.frames);
+	check(stats.overlapped == TEST_READS, "wire bound overlapped", stats.overlapped);
+	check(stats.wireBound == TEST_READS, "wire bound reads", stats.wireBound);
+	check(stats.cpuBound == 0, "wire bound cpu", stats.cpuBound);
+	check(stats.errors == 0, "wire bound stats errors", stats.errors);
+	check(async.blocking == 0, "wire bound blocking frames", async.blocking);
+	fixture.sensor.sBus = &fixture.bus;
+}
+
+static void testCpuBound(SimFixture &fixture)
+{
+	AsyncBus async(fixture.bus);
+	fixture.sensor.sBus = &async;
+	Tle5012bPipeline pipeline(fixture.sensor);
+
+	// the frame overlaps the decode but is done before the next read
+	async.wirePolls = 1;
+	check(run(pipeline, TEST_READS) == 0, "cpu bound errors", 0);
+	const Tle5012bPipeline::Stats_t &stats = pipeline.getStats();
+	check(stats.overlapped == TEST_READS, "cpu bound overlapped", stats.overlapped);
+	// only the first frame from start was not polled before the first read
+	check(stats.wireBound == 1, "cpu bound wire", stats.wireBound);
+	check(stats.cpuBound == TEST_READS - 1, "cpu bound reads", stats.cpuBound);
+	fixture.sensor.sBus = &fixture.bus;
+}
+
+static void testCrcError(SimFixture &fixture)
+{
+	AsyncBus async(fixture.bus);
+	fixture.sensor.sBus = &async;
+	Tle5012bPipeline pipeline(fixture.sensor);
+
+	// the frame in flight is dropped, one STAT read resets the safety word, then the pipeline restarts
+	async.wirePolls = 2;
+	check(run(pipeline, TEST_CRC_READ) == 0, "crc recovery errors", 0);
+	const Tle5012bPipeline::Stats_t &stats = pipeline.getStats();
+	check(stats.frames == TEST_READS, "crc frames", stats.frames);
+	check(stats.errors == 1, "crc stats errors", stats.errors);
+	check(async.blocking == 1, "resetSafety frames", async.blocking);
+	check(async.started == TEST_READS + 2, "started frames", async.started);
+	fixture.sensor.sBus = &fixture.bus;
+}
+
+static void testBlocking(SimFixture &fixture)
+{
+	Tle5012bPipeline pipeline(fixture.sensor);
+
+	// the default startTransfer is the blocking sendReceive
+	check(run(pipeline, TEST_READS) == 0, "blocking errors", 0);
+	const Tle5012bPipeline::Stats_t &stats = pipeline.getStats();
+	check(stats.frames == TEST_READS, "blocking frames", stats.frames);
+	check(stats.overlapped == 0, "blocking overlapped", stats.overlapped);
+	check(stats.cpuBound == TEST_READS, "blocking cpu", stats.cpuBound);
+}
+
+int main()
+{
+	SimFixture fixture;
+	if (!fixture.ready)
+	{
+		return (result());
+	}
+	testWireBound(fixture);
+	testCpuBound(fixture);
+	testCrcError(fixture);
+	testBlocking(fixture);
+	return (result());
+}
@@ -0,0 +1,138 @@
+/**
+ * @file        test-pwm.cpp
+ * @brief       PWM decoder test against timing vectors of the IFA output
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * The frame vectors are high time and period in capture ticks with the
+ * expected result, including period jitter, out of tolerance periods and
+ * the diagnostic duty cycles. The edge vectors are timestamped IFA edges
+ * with glitches and a missed edge as a capture unit delivers them.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_pwm.hpp"
+#include <math.h>
+
+#define TEST_ANGLE_TOLERANCE    0.1    //!< allowed angle error in degrees
+
+struct Frame_t
+{
+	uint8_t     ifabres;
+	uint32_t    tickRate;
+	uint32_t    high;
+	uint32_t    period;
+	errorTypes  status;
+	double      angle;
+};
+
+static const Frame_t frames[] = {
+	// 244 Hz at 1 MHz, 4096 ticks per frame
+	{ 0, 1000000UL,  256, 4096, NO_ERROR,            0.0 },
+	{ 0, 1000000UL,  704, 4096, NO_ERROR,           45.0 },
+	{ 0, 1000000UL, 1152, 4096, NO_ERROR,           90.0 },
+	{ 0, 1000000UL, 2048, 4096, NO_ERROR,         -180.0 },
+	{ 0, 1000000UL, 2944, 4096, NO_ERROR,          -90.0 },
+	{ 0, 1000000UL, 3840, 4096, NO_ERROR,            0.0 },
+	// period jitter of the sensor oscillator
+	{ 0, 1000000UL, 1153, 4100, NO_ERROR,           89.99 },
+	{ 0, 1000000UL, 1150, 4090, NO_ERROR,           89.97 },
+	{ 0, 1000000UL, 3776, 4400, NO_ERROR,          -32.64 },
+	// period out of the 10 % tolerance
+	{ 0, 1000000UL, 1152, 4600, INTERFACE_ACCESS_ERROR, 0.0 },
+	{ 0, 1000000UL, 1152, 3600, INTERFACE_ACCESS_ERROR, 0.0 },
+	{ 0, 1000000UL, 4096, 4096, INTERFACE_ACCESS_ERROR, 0.0 },
+	// diagnostic duty cycles below 6.25 % and above 93.75 %
+	{ 0, 1000000UL,  100, 4096, SYSTEM_ERROR,        0.0 },
+	{ 0, 1000000UL, 4000, 4096, SYSTEM_ERROR,        0.0 },
+	// 977 Hz at 1 MHz and 1953 Hz at 8 MHz
+	{ 2, 1000000UL,  288, 1024, NO_ERROR,           90.0 },
+	{ 3, 8000000UL, 3392, 4096, NO_ERROR,          -45.0 },
+};
+
+struct Edge_t
+{
+	bool        level;
+	uint32_t    timestamp;
+};
+
+// 45° frames at 244 Hz and 1 MHz with a low glitch in the high phase, a high
+// glitch in the low phase, then a missed falling edge
+static const Edge_t edges[] = {
+	{ false,     0 },
+	{ true,   1000 }, { false,  1704 },
+	{ true,   5096 }, { false,  5300 }, { true,   5301 }, { false,  5800 },
+	{ true,   9192 }, { false,  9896 }, { true,  11000 }, { false, 11001 },
+	{ true,  13288 }, { false, 13992 },
+	{ true,  17384 }, { true,  21480 },
+};
+
+static double wrap(double angle)
+{
+	while (angle > 180.0)
+	{
+		angle -= 360.0;
+	}
+	while (angle <= -180.0)
+	{
+		angle += 360.0;
+	}
+	return (angle);
+}
+
+static void testFrames()
+{
+	for (uint32_t i = 0; i < sizeof(frames) / sizeof(frames[0]); i++)
+	{
+		const Frame_t &v = frames[i];
+		PWMDecoder decoder;
+		double angle = 0.0;
+		decoder.configure(v.ifabres, v.tickRate);
+		check(decoder.frame(v.high, v.period) == v.status, "frame status", i);
+		check(decoder.getAngleValue(angle) == v.status, "angle status", i);
+		if (v.status == NO_ERROR)
+		{
+			check(fabs(wrap(angle - v.angle)) < TEST_ANGLE_TOLERANCE, "angle", i);
+		}
+	}
+}
+
+static void testEdges()
+{
+	PWMDecoder decoder;
+	double angle = 0.0;
+	uint32_t n = sizeof(edges) / sizeof(edges[0]);
+
+	decoder.configure(0, 1000000UL);
+	decoder.setGlitchFilter(2);
+	check(decoder.getAngleValue(angle) == INTERFACE_ACCESS_ERROR, "no frame yet", 0);
+	check(decoder.isStale(0), "stale before the first frame", 0);
+
+	// up to the frame after the glitches
+	for (uint32_t i = 0; i < n - 2; i++)
+	{
+		decoder.edge(edges[i].level, edges[i].timestamp);
+	}
+	check(decoder.getAngleValue(angle) == NO_ERROR, "edge status", 0);
+	check(fabs(angle - 45.0) < TEST_ANGLE_TOLERANCE, "edge angle", 0);
+	check(decoder.getStats().frames == 3, "frames", decoder.getStats().frames);
+	check(decoder.getStats().glitches == 2, "glitches", decoder.getStats().glitches);
+	check(decoder.getStats().frameErrors == 0, "frame errors", decoder.getStats().frameErrors);
+	check(!decoder.isStale(edges[n - 3].timestamp + 4096), "fresh", 0);
+
+	// the falling edge before the last rising edge is missing
+	decoder.edge(edges[n - 2].level, edges[n - 2].timestamp);
+	decoder.edge(edges[n - 1].level, edges[n - 1].timestamp);
+	check(decoder.getAngleValue(angle) == INTERFACE_ACCESS_ERROR, "missed edge status", 0);
+	check(decoder.getStats().frameErrors == 1, "missed edge", decoder.getStats().frameErrors);
+	check(decoder.isStale(edges[n - 1].timestamp + 9000), "stale without frames", 0);
+}
+
+int main()
+{
+	testFrames();
+	testEdges();
+	return (result());
+}
@@ -0,0 +1,378 @@
+/**
+ * @file        test-spc.cpp
+ * @brief       SPC decoder and master test with synthetic frames of up to four sensors
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * Falling edge timestamps of SPC frames are built for all four frame layouts
+ * and fed into SPCDecoder: the synchronization period of all four slave
+ * numbers, a sensor clock off by up to 10 % and beyond the tolerance, a CRC
+ * error and a broken nibble. Tle5012bSPC triggers sensors on a simulated line,
+ * which answer the trigger low time of their slave number, reports a missing
+ * sensor as timeout and rejects a capture which is too coarse for the unit time.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_spc.hpp"
+
+#define TEST_UT             24U         //!< unit time of the decoder tests in ticks
+#define TEST_TICK_RATE      16000000UL  //!< fast timer capture, 48 ticks for 3.0 µs
+#define TEST_SLOW_RATE      1000000UL   //!< microsecond capture, 3 ticks for 3.0 µs
+#define TEST_DRIVE          1U          //!< GPIO mode which drives the line low
+#define TEST_RELEASE        0U          //!< GPIO mode which releases the line
+
+//!< reference CRC4, bitwise with the polynomial x^4 + x^3 + x^2 + 1
+static uint8_t referenceCrc4(const uint8_t nibbles[], uint8_t count)
+{
+	uint8_t crc = SPC_CRC_SEED;
+	for (uint8_t i = 0; i <= count; i++)
+	{
+		for (uint8_t bit = 0; bit < 4; bit++)
+		{
+			crc = (uint8_t) (crc << 1);
+			if (crc & 0x10)
+			{
+				crc ^= 0x1D;
+			}
+		}
+		// the last round is the augmentation with a zero nibble
+		crc ^= (i < count) ? nibbles[i] : 0;
+	}
+	return (crc);
+}
+
+/**
+ * @brief builds the falling edges of a frame, the trigger edge at start, then the
+ * sync period, the status and data nibbles and the CRC nibble, returns the number of edges
+ */
+static uint8_t buildFrame(uint32_t edges[], uint32_t start, double unitTime, uint16_t syncUT,
+	uint8_t status, const uint8_t data[], uint8_t count)
+{
+	uint8_t nibbles[SPC_MAX_NIBBLES + 2];
+	nibbles[0] = status;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		nibbles[i + 1] = data[i];
+	}
+	nibbles[count + 1] = SPCDecoder::crc4(nibbles, count + 1);
+
+	// the timestamps wrap around like the ones of a free running timer
+	double now = syncUT * unitTime;
+	uint8_t edge = 0;
+	edges[edge++] = start;
+	edges[edge++] = start + (uint32_t) (now + 0.5);
+	for (uint8_t i = 0; i < count + 2; i++)
+	{
+		now += (SPC_NIBBLE_UT + nibbles[i]) * unitTime;
+		edges[edge++] = start + (uint32_t) (now + 0.5);
+	}
+	return (edge);
+}
+
+static void testCrc()
+{
+	uint8_t nibbles[SPC_MAX_NIBBLES + 1];
+	for (uint32_t i = 0; i < 4096; i++)
+	{
+		uint8_t count = (uint8_t) (4 + (i % 4));
+		for (uint8_t j = 0; j < count; j++)
+		{
+			nibbles[j] = (uint8_t) ((i * 7 + j * 13 + (i >> 4)) & 0x0F);
+		}
+		if (SPCDecoder::crc4(nibbles, count) != referenceCrc4(nibbles, count))
+		{
+			check(false, "crc4", i);
+			return;
+		}
+	}
+}
+
+static void testLayouts()
+{
+	// 12 bit angle 0x123, 16 bit angle 0xABCD, temperature 0x5A
+	static const uint8_t data[4][SPC_MAX_NIBBLES] = {
+		{ 0x1, 0x2, 0x3 },
+		{ 0xA, 0xB, 0xC, 0xD },
+		{ 0x1, 0x2, 0x3, 0x5, 0xA },
+		{ 0xA, 0xB, 0xC, 0xD, 0x5, 0xA } };
+	SPCDecoder decoder;
+	uint32_t edges[SPC_MAX_EDGES];
+
+	for (uint8_t config = 0; config < 4; config++)
+	{
+		SPCDecoder::Frame_t frame = {};
+		decoder.configure((SPCDecoder::frameConfig_t) config);
+		check(decoder.dataNibbles() == config + 3, "data nibbles", config);
+		uint8_t count = buildFrame(edges, 1000, TEST_UT, SPC_SYNC_UT, 0x9, data[config], decoder.dataNibbles());
+		check(count == decoder.frameEdges(), "frame edges", count);
+		check(decoder.decode(edges, count, SPC_SYNC_UT, TEST_UT << 8, frame) == NO_ERROR, "layout status", config);
+		check(frame.status == 0x9, "layout frame status", frame.status);
+		check(frame.unitTime == TEST_UT << 8, "layout unit time", frame.unitTime);
+		bool wide = (config == SPCDecoder::SPC_ANGLE_16) || (config == SPCDecoder::SPC_ANGLE_16_TEMP);
+		check(frame.angle == (wide ? 0xABCD : 0x123), "layout angle", frame.angle);
+		check(frame.rawAngle == (wide ? -10778 : 2328), "layout raw angle", frame.rawAngle);
+		check(frame.temperature == ((config >= SPCDecoder::SPC_ANGLE_12_TEMP) ? 0x5A : 0), "layout temperature", frame.temperature);
+	}
+}
+
+static void testSlaves()
+{
+	static const uint8_t data[3] = { 0xF, 0x0, 0x7 };
+	SPCDecoder decoder;
+	uint32_t edges[SPC_MAX_EDGES];
+
+	// the sync period follows the trigger low time of the slave number, 24 to 60 UT
+	for (uint8_t slave = 0; slave < SPC_MAX_SLAVES; slave++)
+	{
+		SPCDecoder::Frame_t frame = {};
+		uint16_t syncUT = SPC_TRIGGER_UT * (slave + 1) + SPC_TRIGGER_UT;
+		uint8_t count = buildFrame(edges, 0xFFFFFF00UL, TEST_UT, syncUT, slave, data, 3);
+		check(decoder.decode(edges, count, syncUT, TEST_UT << 8, frame) == NO_ERROR, "slave status", slave);
+		check(frame.status == slave, "slave frame status", frame.status);
+		check(frame.angle == 0xF07, "slave angle", frame.angle);
+	}
+}
+
+static void testSkew()
+{
+	static const uint8_t data[3] = { 0xF, 0xF, 0xF };
+	SPCDecoder decoder;
+	uint32_t edges[SPC_MAX_EDGES];
+	SPCDecoder::Frame_t frame = {};
+
+	// the sync period calibrates a sensor clock off by 10 %
+	uint8_t count = buildFrame(edges, 0, TEST_UT * 1.1, SPC_SYNC_UT, 0, data, 3);
+	check(decoder.decode(edges, count, SPC_SYNC_UT, TEST_UT << 8, frame) == NO_ERROR, "fast skew", 0);
+	check(frame.angle == 0xFFF, "fast skew angle", frame.angle);
+	check(frame.unitTime > (TEST_UT << 8) * 1.09 && frame.unitTime < (TEST_UT << 8) * 1.11, "fast unit time", frame.unitTime);
+	count = buildFrame(edges, 0, TEST_UT * 0.9, SPC_SYNC_UT, 0, data, 3);
+	check(decoder.decode(edges, count, SPC_SYNC_UT, TEST_UT << 8, frame) == NO_ERROR, "slow skew", 0);
+	check(frame.angle == 0xFFF, "slow skew angle", frame.angle);
+
+	// beyond SPC_SYNC_TOLERANCE the frame is rejected, without a nominal unit time it is decoded
+	count = buildFrame(edges, 0, TEST_UT * 1.3, SPC_SYNC_UT, 0, data, 3);
+	check(decoder.decode(edges, count, SPC_SYNC_UT, TEST_UT << 8, frame) == INTERFACE_ACCESS_ERROR, "skew beyond tolerance", 0);
+	check(decoder.decode(edges, count, SPC_SYNC_UT, 0, frame) == NO_ERROR, "skew without nominal", 0);
+}
+
+static void testErrors()
+{
+	static const uint8_t data[3] = { 0x1, 0x2, 0x3 };
+	SPCDecoder decoder;
+	uint32_t edges[SPC_MAX_EDGES];
+	SPCDecoder::Frame_t frame = {};
+
+	// a data nibble which is one UT longer, the CRC does not match
+	uint8_t count = buildFrame(edges, 0, TEST_UT, SPC_SYNC_UT, 0, data, 3);
+	for (uint8_t i = 3; i < count; i++)
+	{
+		edges[i] += TEST_UT;
+	}
+	check(decoder.decode(edges, count, SPC_SYNC_UT, TEST_UT << 8, frame) == CRC_ERROR, "crc error", 0);
+
+	// a nibble longer than 27 UT
+	count = buildFrame(edges, 0, TEST_UT, SPC_SYNC_UT, 0, data, 3);
+	for (uint8_t i = 3; i < count; i++)
+	{
+		edges[i] += 16 * TEST_UT;
+	}
+	check(decoder.decode(edges, count, SPC_SYNC_UT, TEST_UT << 8, frame) == INTERFACE_ACCESS_ERROR, "long nibble", 0);
+
+	// a missing edge
+	count = buildFrame(edges, 0, TEST_UT, SPC_SYNC_UT, 0, data, 3);
+	check(decoder.decode(edges, count - 1, SPC_SYNC_UT, TEST_UT << 8, frame) == INTERFACE_ACCESS_ERROR, "missing edge", 0);
+}
+
+/**
+ * @brief Capture whose clock advances one tick on each now call
+ */
+class LineCapture: public Capture
+{
+	public:
+
+		uint32_t    rate;         //!< ticks per second
+		uint32_t    clock;        //!< actual time in ticks
+
+		LineCapture(uint32_t tickRate): rate(tickRate), clock(0), callback_(NULL), arg_(NULL) {}
+
+		Error_t init(EdgeCallback_t callback, void *arg)
+		{
+			callback_ = callback;
+			arg_ = arg;
+			return OK;
+		}
+
+		Error_t deinit()
+		{
+			callback_ = NULL;
+			return OK;
+		}
+
+		bool level(uint8_t channel) { (void) channel; return true; }
+		uint32_t now() { return clock++; }
+		uint32_t tickRate() { return rate; }
+
+		//!< falling edge on IFA
+		void fall(uint32_t timestamp)
+		{
+			if (callback_ != NULL)
+			{
+				callback_(0, false, timestamp, arg_);
+			}
+		}
+
+	private:
+
+		EdgeCallback_t  callback_;
+		void            *arg_;
+};
+
+/**
+ * @brief SPC line with the trigger output of the master and up to four sensors,
+ * the sensor whose trigger low time matches answers with its frame on release
+ */
+class SpcLine: public GPIO
+{
+	public:
+
+		bool        present[SPC_MAX_SLAVES];  //!< sensor is on the line
+		bool        corrupt[SPC_MAX_SLAVES];  //!< sensor sends a wrong CRC
+		double      unitTime;                 //!< unit time of the sensors in ticks
+		uint32_t    triggers;                 //!< trigger pulses
+
+		SpcLine(LineCapture &capture): unitTime(0), triggers(0), capture_(capture), driven_(false), fallen_(0)
+		{
+			for (uint8_t i = 0; i < SPC_MAX_SLAVES; i++)
+			{
+				present[i] = false;
+				corrupt[i] = false;
+			}
+		}
+
+		Error_t init() { return OK; }
+		Error_t deinit() { return OK; }
+		VLevel_t read() { return driven_ ? GPIO_LOW : GPIO_HIGH; }
+		Error_t write(VLevel_t level) { (void) level; return OK; }
+		Error_t enable() { return OK; }
+		Error_t disable() { return OK; }
+
+		Error_t changeMode(uint8_t mode)
+		{
+			if ((mode == TEST_DRIVE) && !driven_)
+			{
+				driven_ = true;
+				triggers++;
+				fallen_ = capture_.clock;
+				capture_.fall(fallen_);
+			}else if ((mode == TEST_RELEASE) && driven_)
+			{
+				driven_ = false;
+				answer(capture_.clock - fallen_);
+			}
+			return OK;
+		}
+
+	private:
+
+		LineCapture &capture_;
+		bool        driven_;
+		uint32_t    fallen_;
+
+		//!< the sensor selected by the trigger low time sends the frame with its slave number as angle
+		void answer(uint32_t low)
+		{
+			uint32_t edges[SPC_MAX_EDGES];
+			uint8_t slave = (uint8_t) (low / (SPC_TRIGGER_UT * unitTime) + 0.5) - 1;
+			if ((slave >= SPC_MAX_SLAVES) || !present[slave])
+			{
+				return;
+			}
+			uint8_t data[3] = { slave, 0x5, 0xA };
+			uint8_t count = buildFrame(edges, fallen_, unitTime, SPC_SYNC_UT, 0, data, 3);
+			if (corrupt[slave])
+			{
+				edges[count - 1] += (uint32_t) unitTime;
+			}
+			// the trigger edge is already captured
+			for (uint8_t i = 1; i < count; i++)
+			{
+				capture_.fall(edges[i]);
+			}
+		}
+};
+
+static void testMaster()
+{
+	LineCapture capture(TEST_TICK_RATE);
+	SpcLine line(capture);
+	Tle5012bSPC spc(line, capture, TEST_DRIVE, TEST_RELEASE);
+	SPCDecoder::Frame_t frames[SPC_MAX_SLAVES] = {};
+
+	spc.configure(0, SPCDecoder::SPC_ANGLE_12, 0);
+	check(spc.unitTime() == 48U << 8, "master unit time", spc.unitTime());
+	line.unitTime = 48 * 1.05;
+	check(spc.begin() == NO_ERROR, "master begin", 0);
+
+	// sensors 0, 1 and 3 are on the line, 3 with a CRC error
+	line.present[0] = true;
+	line.present[1] = true;
+	line.present[3] = true;
+	line.corrupt[3] = true;
+	check(spc.read(0, frames[0]) == NO_ERROR, "slave 0", 0);
+	check(spc.read(1, frames[1]) == NO_ERROR, "slave 1", 0);
+	check(spc.read(2, frames[2]) == INTERFACE_ACCESS_ERROR, "missing slave", 0);
+	check(spc.read(3, frames[3]) == CRC_ERROR, "slave crc", 0);
+	check(frames[0].angle == 0x05A, "slave 0 angle", frames[0].angle);
+	check(frames[1].angle == 0x15A, "slave 1 angle", frames[1].angle);
+	check(spc.read(SPC_MAX_SLAVES, frames[0]) == SYSTEM_ERROR, "slave number", 0);
+
+	const Tle5012bSPC::Stats_t &stats = spc.getStats();
+	check(stats.frames == 2, "master frames", stats.frames);
+	check(stats.timeouts == 1, "master timeouts", stats.timeouts);
+	check(stats.crcErrors == 1, "master crc errors", stats.crcErrors);
+	check(stats.frameErrors == 0, "master frame errors", stats.frameErrors);
+	check(line.triggers == 4, "master triggers", line.triggers);
+
+	// readAll reports the first error and decodes the other frames
+	line.present[2] = true;
+	line.corrupt[3] = false;
+	check(spc.readAll(frames, SPC_MAX_SLAVES) == NO_ERROR, "read all", 0);
+	check(frames[2].angle == 0x25A, "read all slave 2", frames[2].angle);
+	line.present[1] = false;
+	check(spc.readAll(frames, SPC_MAX_SLAVES) == INTERFACE_ACCESS_ERROR, "read all missing", 0);
+	check(frames[3].angle == 0x35A, "read all slave 3", frames[3].angle);
+	spc.end();
+}
+
+static void testCoarseCapture()
+{
+	LineCapture capture(TEST_SLOW_RATE);
+	SpcLine line(capture);
+	Tle5012bSPC spc(line, capture, TEST_DRIVE, TEST_RELEASE);
+	SPCDecoder::Frame_t frame = {};
+
+	// 3 ticks per UT of a microsecond capture
+	check(spc.begin() == SYSTEM_ERROR, "coarse begin", spc.unitTime());
+	check(spc.read(0, frame) == SYSTEM_ERROR, "coarse read", 0);
+	check(line.triggers == 0, "coarse triggers", line.triggers);
+
+	// 1.5 µs UT at 6 MHz are 9 ticks
+	capture.rate = 6000000UL;
+	spc.configure(3, SPCDecoder::SPC_ANGLE_12, 0);
+	check(spc.begin() == NO_ERROR, "fine begin", spc.unitTime());
+	spc.end();
+}
+
+int main()
+{
+	testCrc();
+	testLayouts();
+	testSlaves();
+	testSkew();
+	testErrors();
+	testMaster();
+	testCoarseCapture();
+	return (result());
+}
@@ -0,0 +1,114 @@
+/**
+ * @file        test-tempcomp.cpp
+ * @brief       Temperature band changes of the offset compensation on the simulated sensor
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * A table of three points is applied while the temperature in FSYNC of the
+ * simulated sensor moves through the bands. Each band change must write
+ * OFFX, OFFY, TCOXT and TCOYT of the new point and exactly one TCO_Y with a
+ * matching CRC. Inside the band and its hysteresis only the burst is read.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "test-util.hpp"
+#include "corelib/tle5012b_tempcomp.hpp"
+
+#define TEST_SIM_FSYNC      0x05U       //!< register address of FSYNC in the simulation
+#define TEST_SIM_OFFX       0x0AU       //!< register address of OFFX in the simulation
+#define TEST_SIM_OFFY       0x0BU       //!< register address of OFFY in the simulation
+#define TEST_SIM_MOD_4      0x0EU       //!< register address of MOD_4 in the simulation
+
+static const Tle5012bTempComp::Point_t points[3] = {
+	{ -20, -100,  50,  3, -4 },
+	{  25,   10, -20,  0,  0 },
+	{  85,  300,  -7, -5, 12 } };
+
+//!< sets the temperature in FSYNC of the simulation
+static void setTemperature(int16_t celsius)
+{
+	sim.regs[TEST_SIM_FSYNC] = (uint16_t) (Tle5012bTempComp::toRaw(celsius) & 0x01FF);
+}
+
+//!< samples and returns the number of TCO_Y writes of the sample
+static uint32_t sampleAt(Tle5012bTempComp &comp, int16_t celsius, int8_t band)
+{
+	Tle5012bTempComp::Sample_t out;
+	uint32_t crcWrites = sim.crcWrites;
+	setTemperature(celsius);
+	check(comp.sample(out) == NO_ERROR, "sample", celsius);
+	check(out.rawTemp == Tle5012bTempComp::toRaw(celsius), "sample temperature", out.rawTemp);
+	check(comp.band() == band, "band", comp.band());
+	return (sim.crcWrites - crcWrites);
+}
+
+//!< checks the registers of the simulation against a table point, the other fields are kept
+static void checkPoint(const Tle5012bTempComp::Point_t &point, const uint16_t initial[])
+{
+	check(sim.regs[TEST_SIM_OFFX] == Reg::REG_OFFX_XOFFSET::insert(initial[0], (uint16_t) point.offsetX), "offx", sim.regs[TEST_SIM_OFFX]);
+	check(sim.regs[TEST_SIM_OFFY] == Reg::REG_OFFY_YOFFSET::insert(initial[1], (uint16_t) point.offsetY), "offy", sim.regs[TEST_SIM_OFFY]);
+	check(sim.regs[TEST_SIM_MOD_4] == Reg::REG_MOD_4_TCOXT::insert(initial[2], (uint16_t) point.tcoX), "mod4", sim.regs[TEST_SIM_MOD_4]);
+	check(Reg::REG_TCO_Y_TCOYT::extract(sim.regs[SIM_CRC_LAST]) == Reg::REG_TCO_Y_TCOYT::extract(Reg::REG_TCO_Y_TCOYT::insert(0, (uint16_t) point.tcoY)),
+		"tcoyt", sim.regs[SIM_CRC_LAST]);
+	check((sim.regs[SIM_CRC_LAST] & 0xFF) == sim.blockCrc(), "block crc", sim.regs[SIM_CRC_LAST]);
+}
+
+int main()
+{
+	SimFixture fixture;
+	if (!fixture.ready)
+	{
+		return (result());
+	}
+	Tle5012bTempComp comp(fixture.sensor);
+	const uint16_t initial[3] = { sim.regs[TEST_SIM_OFFX], sim.regs[TEST_SIM_OFFY], sim.regs[TEST_SIM_MOD_4] };
+	Tle5012bTempComp::Point_t unsorted[2] = { points[1], points[0] };
+
+	check(comp.setTable(points, 0) == SYSTEM_ERROR, "empty table", 0);
+	check(comp.setTable(unsorted, 2) == SYSTEM_ERROR, "unsorted table", 0);
+	check(comp.setTable(points, 3) == NO_ERROR, "table", 0);
+
+	// the first sample applies the point of its band, bands change at 2°C and 55°C
+	check(sampleAt(comp, 25, 1) == 1, "first band tco_y writes", 0);
+	checkPoint(points[1], initial);
+
+	// inside the band only the burst is read
+	uint32_t frames = sim.frames;
+	check(sampleAt(comp, 40, 1) == 0, "same band tco_y writes", 0);
+	check(sampleAt(comp, 56, 1) == 0, "upper hysteresis tco_y writes", 0);
+	check(sim.frames - frames == 2, "same band frames", sim.frames - frames);
+
+	// up beyond the hysteresis, and back down inside the hysteresis of the new band
+	check(sampleAt(comp, 58, 2) == 1, "hot band tco_y writes", 0);
+	checkPoint(points[2], initial);
+	check(sampleAt(comp, 54, 2) == 0, "lower hysteresis tco_y writes", 0);
+
+	// down over two bands with one write of the cold point
+	check(sampleAt(comp, -30, 0) == 1, "cold band tco_y writes", 0);
+	checkPoint(points[0], initial);
+	check(sampleAt(comp, 1, 0) == 0, "cold hysteresis tco_y writes", 0);
+
+	// the same point again writes nothing
+	uint32_t writes = comp.getStats().writes;
+	comp.reset();
+	check(sampleAt(comp, -30, 0) == 0, "unchanged point tco_y writes", 0);
+	check(comp.getStats().writes == writes, "unchanged point writes", comp.getStats().writes - writes);
+
+	check(sim.crcErrors == 0, "crc errors", sim.crcErrors);
+	const Tle5012bTempComp::Stats_t &stats = comp.getStats();
+	check(stats.samples == 8, "samples", stats.samples);
+	check(stats.updates == 4, "updates", stats.updates);
+	check(stats.errors == 0, "errors", stats.errors);
+
+	// a failed burst changes nothing
+	Tle5012bTempComp::Sample_t out;
+	setTemperature(25);
+	sim.failNext = 1;
+	check(comp.sample(out) != NO_ERROR, "failed sample", 0);
+	check(comp.band() == 0, "failed sample band", comp.band());
+	check(stats.errors == 1, "failed sample errors", stats.errors);
+	check(comp.apply(3) == SYSTEM_ERROR, "invalid point", 0);
+
+	return (result());
+}
@@ -0,0 +1,74 @@
+/**
+ * @file        test-util.hpp
+ * @brief       Checks, result and sensor fixture shared by the host tests
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * Each test is one executable: check counts the failed conditions, result
+ * prints PASS or the number of failed checks and returns the exit code.
+ * SimFixture connects a Tle5012b to the simulated sensor on the Linux PAL.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef TEST_UTIL_HPP_
+#define TEST_UTIL_HPP_
+
+#include "sim-sensor.hpp"
+#include "corelib/TLE5012b.hpp"
+#include <stdio.h>
+
+static uint32_t failures = 0;     //!< failed checks of the test
+
+//!< counts and prints a failed condition with the value under test
+static inline void check(bool condition, const char *what, double value)
+{
+	if (!condition)
+	{
+		printf("FAIL %s %g\n", what, value);
+		failures++;
+	}
+}
+
+//!< prints the result of the test, returns the exit code for ctest
+static inline int result()
+{
+	if (failures != 0)
+	{
+		printf("FAIL %u checks\n", failures);
+		return (1);
+	}
+	printf("PASS\n");
+	return (0);
+}
+
+/**
+ * @brief Tle5012b on the simulated sensor, the bus is opened by the
+ * constructor and closed by the destructor. ready is false if the bus
+ * could not be opened.
+ */
+struct SimFixture
+{
+	SPICLinux   bus;          //!< spidev PAL with the SimSensor backend
+	Tle5012b    sensor;       //!< sensor under test
+	bool        ready;        //!< bus is open
+
+	SimFixture(): bus("/dev/spidev0.0", true, "/dev/gpiochip0", 5, SimSensor::backend)
+	{
+		sim.reset();
+		sensor.sBus = &bus;
+		ready = (bus.init() == SPIC::OK);
+		check(ready, "bus init", 0);
+	}
+
+	~SimFixture()
+	{
+		bus.deinit();
+		sensor.sBus = NULL;
+	}
+
+	SimFixture(const SimFixture &) = delete;
+	SimFixture &operator=(const SimFixture &) = delete;
+};
+
+#endif /** TEST_UTIL_HPP_ **/
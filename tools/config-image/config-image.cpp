@@ -0,0 +1,131 @@
+/**
+ * @file        config-image.cpp
+ * @brief       Host tool to inspect and diff binary configuration images
+ * @date        October 2020
+ * @copyright   Copyright (c) 2019-2020 Infineon Technologies AG
+ *
+ * Reads images exported with ConfigShadow::exportImage, e.g. collected from
+ * a fleet of sensors, and checks them with ConfigShadow::importImage.
+ *
+ *   config-image show IMAGE...    prints the registers of each image
+ *   config-image diff FROM TO     prints the write sequence from FROM to TO
+ *
+ * The exit code is 0 for valid images without differences, 1 if diff found
+ * differences and 2 for an invalid image or wrong arguments.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "corelib/tle5012b_shadow.hpp"
+#include <stdio.h>
+#include <string.h>
+
+#define TOOL_OK             0
+#define TOOL_DIFFERENT      1
+#define TOOL_ERROR          2
+
+//!< register names of the image indices
+static const char *names[SHADOW_REGISTERS] = {
+	"ACSTAT", "MOD_1", "SIL", "MOD_2", "MOD_3", "OFFX", "OFFY", "SYNCH", "IFAB", "MOD_4", "TCO_Y"
+};
+
+//!< variant names in the order of Reg::sensorType_t
+static const char *variants[] = {
+	"TLE5012B_E1000", "TLE5012B_E3005", "TLE5012B_E5000", "TLE5012B_E5020", "TLE5012B_E9000"
+};
+
+static const char *variantName(uint8_t variant)
+{
+	if (variant < sizeof(variants) / sizeof(variants[0]))
+	{
+		return (variants[variant]);
+	}
+	return ((variant == SHADOW_VARIANT_UNKNOWN) ? "unknown" : "invalid");
+}
+
+//!< reads and imports one image file, one byte more than an image is read to catch longer files
+static bool load(const char *path, ConfigShadow::Image_t &image, uint8_t &variant)
+{
+	uint8_t buffer[SHADOW_IMAGE_SIZE + 1];
+	FILE *file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "%s: can not open\n", path);
+		return (false);
+	}
+	size_t length = fread(buffer, 1, sizeof(buffer), file);
+	fclose(file);
+
+	errorTypes status = ConfigShadow::importImage(buffer, (uint16_t) length, image, variant);
+	if (status == CRC_ERROR)
+	{
+		fprintf(stderr, "%s: wrong image CRC\n", path);
+		return (false);
+	}
+	if (status != NO_ERROR)
+	{
+		fprintf(stderr, "%s: no image, wrong size, magic or version\n", path);
+		return (false);
+	}
+	return (true);
+}
+
+static int show(int count, char *paths[])
+{
+	int result = TOOL_OK;
+	for (int f = 0; f < count; f++)
+	{
+		ConfigShadow::Image_t image;
+		uint8_t variant = 0;
+		if (!load(paths[f], image, variant))
+		{
+			result = TOOL_ERROR;
+			continue;
+		}
+		printf("%s: %s\n", paths[f], variantName(variant));
+		for (uint8_t i = 0; i < SHADOW_REGISTERS; i++)
+		{
+			printf("  %-6s 0x%04X  0x%04X\n", names[i], ConfigShadow::command(i), image.regs[i]);
+		}
+	}
+	return (result);
+}
+
+static int diff(const char *from, const char *to)
+{
+	ConfigShadow::Image_t current;
+	ConfigShadow::Image_t target;
+	ConfigShadow::Write_t writes[SHADOW_REGISTERS];
+	uint8_t currentVariant = 0;
+	uint8_t targetVariant = 0;
+
+	if (!load(from, current, currentVariant) || !load(to, target, targetVariant))
+	{
+		return (TOOL_ERROR);
+	}
+	if (currentVariant != targetVariant)
+	{
+		printf("variant %s -> %s\n", variantName(currentVariant), variantName(targetVariant));
+	}
+	uint8_t count = ConfigShadow::diff(current, target, writes);
+	for (uint8_t i = 0; i < count; i++)
+	{
+		uint8_t index = ConfigShadow::index(writes[i].command);
+		printf("%-6s 0x%04X  0x%04X -> 0x%04X\n", names[index], writes[i].command, current.regs[index], writes[i].data);
+	}
+	return (((count != 0) || (currentVariant != targetVariant)) ? TOOL_DIFFERENT : TOOL_OK);
+}
+
+int main(int argc, char *argv[])
+{
+	if ((argc >= 3) && (strcmp(argv[1], "show") == 0))
+	{
+		return (show(argc - 2, &argv[2]));
+	}
+	if ((argc == 4) && (strcmp(argv[1], "diff") == 0))
+	{
+		return (diff(argv[2], argv[3]));
+	}
+	fprintf(stderr, "usage: %s show IMAGE...\n       %s diff FROM TO\n", argv[0], argv[0]);
+	return (TOOL_ERROR);
+}